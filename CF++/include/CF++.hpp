@@ -38,6 +38,14 @@
 #include <memory>
 #include <algorithm>
 
+#if __cplusplus >= 201703L
+#include <string_view>
+#endif
+
+#if __cplusplus >= 202002L
+#include <span>
+#endif
+
 /*
  * Disable warnings about class members not having DLL-interface.
  * Eg: std::shared_ptr
@@ -67,14 +75,24 @@
 #include <CF++/CFPP-Boolean.hpp>
 #include <CF++/CFPP-Number.hpp>
 #include <CF++/CFPP-String.hpp>
+#include <CF++/CFPP-StaticString.hpp>
 #include <CF++/CFPP-URL.hpp>
 #include <CF++/CFPP-Data.hpp>
+#include <CF++/CFPP-DataView.hpp>
+#include <CF++/CFPP-CRC32C.hpp>
+#include <CF++/CFPP-XXHash64.hpp>
+#include <CF++/CFPP-SHA256.hpp>
+#include <CF++/CFPP-DataRope.hpp>
 #include <CF++/CFPP-Date.hpp>
+#include <CF++/CFPP-StringBuilder.hpp>
 #include <CF++/CFPP-Array.hpp>
 #include <CF++/CFPP-Pair.hpp>
 #include <CF++/CFPP-Dictionary.hpp>
 #include <CF++/CFPP-Error.hpp>
 #include <CF++/CFPP-UUID.hpp>
+#include <CF++/CFPP-TypedArray.hpp>
+#include <CF++/CFPP-ThreadPool.hpp>
+#include <CF++/CFPP-Parallel.hpp>
 #include <CF++/CFPP-ReadStream.hpp>
 #include <CF++/CFPP-WriteStream.hpp>
 #include <CF++/CFPP-PropertyListType-Definition.hpp>
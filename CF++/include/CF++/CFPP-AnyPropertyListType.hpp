@@ -34,6 +34,7 @@
 namespace CF
 {
     class Data;
+    class DataView;
     
     class CFPP_EXPORT AnyPropertyListType: public PropertyListBase
     {
@@ -42,6 +43,7 @@ namespace CF
             static AnyPropertyListType FromPropertyList( const std::string & path );
             static AnyPropertyListType FromPropertyListString( const std::string & plist );
             static AnyPropertyListType FromPropertyListData( const Data & plist );
+            static AnyPropertyListType FromPropertyListData( const DataView & plist );
             
             AnyPropertyListType( PropertyListFormat format );
             AnyPropertyListType( const AnyPropertyListType & value );
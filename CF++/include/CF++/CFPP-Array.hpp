@@ -32,9 +32,25 @@
 #define CFPP_ARRAY_HPP
 
 #include <vector>
+#include <iterator>
+#include <memory>
+#include <functional>
+#include <atomic>
+#include <type_traits>
 
 namespace CF
 {
+    /*
+     * Values that can be stored through the iterator range templates.
+     * C strings also convert to CFTypeRef, but aren't CF objects.
+     */
+    template< typename _T_ >
+    struct ArrayValueTraits
+    {
+        static const bool IsValue = std::is_convertible< _T_, CFTypeRef >::value
+                                 && std::is_same< typename std::remove_cv< typename std::remove_pointer< _T_ >::type >::type, char >::value == false;
+    };
+    
     class CFPP_EXPORT Array: public PropertyListType< Array >
     {
         public:
@@ -49,8 +65,21 @@ namespace CF
             Array( CFArrayRef value );
             Array( std::nullptr_t );
             Array( std::initializer_list< CFTypeRef > value );
+            Array( const CFTypeRef * values, CFIndex count );
+            Array( const std::vector< CFTypeRef > & value );
+            Array( const std::vector< String > & value );
             Array( Array && value ) noexcept;
             
+            #if __cplusplus >= 202002L
+            Array( std::span< const CFTypeRef > value );
+            #endif
+            
+            template< typename InputIterator, typename = typename std::enable_if< ArrayValueTraits< typename std::iterator_traits< InputIterator >::value_type >::IsValue >::type >
+            Array( InputIterator first, InputIterator last ): Array()
+            {
+                this->AppendValues( first, last );
+            }
+            
             ~Array() override;
             
             Array & operator =( Array value );
@@ -66,6 +95,7 @@ namespace CF
             Array & operator << ( CFTypeRef value );
             Array & operator << ( const char * value );
             Array & operator << ( const String & value );
+            Array & operator << ( const StaticString & value );
             Array & operator << ( const Number & value );
             
             CFTypeRef operator [] ( int index ) const;
@@ -73,6 +103,8 @@ namespace CF
             CFTypeID  GetTypeID()   const override;
             CFTypeRef GetCFObject() const override;
             
+            operator CFMutableArrayRef () const override;
+            
             CFIndex   GetCount()                       const;
             bool      ContainsValue( CFTypeRef value ) const;
             CFTypeRef GetValueAtIndex( CFIndex index ) const;
@@ -82,25 +114,43 @@ namespace CF
             void InsertValueAtIndex( CFTypeRef value, CFIndex index );
             void AppendValue( CFTypeRef value );
             void RemoveValueAtIndex( CFIndex index );
+            void AppendValues( const CFTypeRef * values, CFIndex count );
             void AppendArray( CFArrayRef array );
             void ExchangeValuesAtIndices( CFIndex index1, CFIndex index2 );
+            void Reserve( CFIndex capacity );
+            
+            template< typename InputIterator, typename = typename std::enable_if< ArrayValueTraits< typename std::iterator_traits< InputIterator >::value_type >::IsValue >::type >
+            void AppendValues( InputIterator first, InputIterator last )
+            {
+                std::vector< CFTypeRef > values;
+                
+                ReserveValues( values, first, last, typename std::iterator_traits< InputIterator >::iterator_category() );
+                
+                for( ; first != last; ++first )
+                {
+                    values.push_back( RetainValue( static_cast< CFTypeRef >( *( first ) ) ) );
+                }
+                
+                this->AppendValues( values.data(), static_cast< CFIndex >( values.size() ) );
+                ReleaseValues( values );
+            }
                         
             friend void swap( Array & v1, Array & v2 ) noexcept;
             
             #if __cplusplus >= 201703L
             class CFPP_EXPORT Iterator
             #else
-            class CFPP_EXPORT Iterator: public Type, public std::iterator< std::bidirectional_iterator_tag, CFTypeRef >
+            class CFPP_EXPORT Iterator: public Type, public std::iterator< std::random_access_iterator_tag, CFTypeRef, ptrdiff_t, const CFTypeRef *, CFTypeRef >
             #endif
             {
                 public:
                 
                     #if __cplusplus >= 201703L
-                    using iterator_category = std::bidirectional_iterator_tag;
+                    using iterator_category = std::random_access_iterator_tag;
                     using value_type        = CFTypeRef;
                     using difference_type   = ptrdiff_t;
-                    using pointer           = CFTypeRef *;
-                    using reference         = CFTypeRef &;
+                    using pointer           = const CFTypeRef *;
+                    using reference         = CFTypeRef;
                     #endif
                     
                     Iterator();
@@ -118,38 +168,80 @@ namespace CF
                     Iterator & operator += ( CFIndex value );
                     Iterator & operator -= ( CFIndex value );
                     
-                    Iterator operator +( CFIndex value );
-                    Iterator operator -( CFIndex value );
+                    Iterator operator +( CFIndex value ) const;
+                    Iterator operator -( CFIndex value ) const;
+                    
+                    ptrdiff_t operator -( const Iterator & value ) const;
                     
                     bool operator == ( const Iterator & value ) const;
                     bool operator != ( const Iterator & value ) const;
+                    bool operator <  ( const Iterator & value ) const;
+                    bool operator >  ( const Iterator & value ) const;
+                    bool operator <= ( const Iterator & value ) const;
+                    bool operator >= ( const Iterator & value ) const;
                     
                     CFTypeRef operator *() const;
+                    CFTypeRef operator []( CFIndex index ) const;
                     
                     operator CFTypeRef () const;
                     
                     CFTypeID  GetTypeID()   const;
                     CFTypeRef GetCFObject() const;
                     
+                    friend Iterator operator +( CFIndex v1, const Iterator & v2 );
+                    
                     friend void swap( Iterator & v1, Iterator & v2 ) noexcept;
                     
                 private:
                     
                     friend class Array;
                     
-                    Iterator( CFArrayRef array, CFIndex count, CFIndex pos = 0 );
+                    struct Snapshot;
+                    
+                    Iterator( const Array & array, CFIndex pos, bool snapshot );
                     
-                    CFArrayRef _cfObject;
-                    CFIndex    _count;
-                    CFIndex    _pos;
+                    CFTypeRef GetValueAtIndex( CFIndex index ) const;
+                    
+                    std::shared_ptr< Snapshot > _snapshot;
+                    CFArrayRef                  _cfObject;
+                    const CFTypeRef           * _values;
+                    CFIndex                     _count;
+                    CFIndex                     _pos;
             };
             
             Iterator begin() const;
             Iterator end()   const;
             
+            void ForEach( const std::function< void( CFTypeRef ) > & function ) const;
+            
         protected:
             
-            CFMutableArrayRef _cfObject;
+            struct Share;
+            
+            static CFTypeRef RetainValue( CFTypeRef value );
+            static void      ReleaseValues( const std::vector< CFTypeRef > & values );
+            
+            template< typename InputIterator >
+            static void ReserveValues( std::vector< CFTypeRef > & values, InputIterator first, InputIterator last, std::input_iterator_tag )
+            {
+                ( void )values;
+                ( void )first;
+                ( void )last;
+            }
+            
+            template< typename ForwardIterator >
+            static void ReserveValues( std::vector< CFTypeRef > & values, ForwardIterator first, ForwardIterator last, std::forward_iterator_tag )
+            {
+                values.reserve( static_cast< size_t >( std::distance( first, last ) ) );
+            }
+            
+            void Detach()       const;
+            void ReleaseShare() const;
+            
+            mutable CFMutableArrayRef      _cfObject;
+            mutable std::atomic< Share * > _share;
+            mutable bool                   _mutable;
+            mutable bool                   _unshareable;
     };
 }
 
@@ -0,0 +1,63 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+/*!
+ * @header      CFPP-CRC32C.h
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    CoreFoundation++ incremental CRC-32C checksum
+ */
+
+#ifndef CFPP_CRC32C_HPP
+#define CFPP_CRC32C_HPP
+
+namespace CF
+{
+    class CFPP_EXPORT CRC32C
+    {
+        public:
+            
+            CRC32C();
+            CRC32C( const CRC32C & value );
+            CRC32C( CRC32C && value ) noexcept;
+            
+            virtual ~CRC32C();
+            
+            CRC32C & operator =( CRC32C value );
+            CRC32C & operator << ( const DataView & value );
+            
+            void   Update( const Data::Byte * bytes, CFIndex length );
+            void   Update( const DataView & data );
+            UInt32 GetValue() const;
+            void   Reset();
+            
+            friend void swap( CRC32C & v1, CRC32C & v2 ) noexcept;
+            
+        private:
+            
+            UInt32 _crc;
+    };
+}
+
+#endif /* CFPP_CRC32C_HPP */
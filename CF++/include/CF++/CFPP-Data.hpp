@@ -32,9 +32,15 @@
 #define CFPP_DATA_HPP
 
 #include <vector>
+#include <functional>
+#include <atomic>
 
 namespace CF
 {
+    class DataView;
+    class ReadStream;
+    class WriteStream;
+    
     class CFPP_EXPORT Data: public PropertyListType< Data >
     {
         public:
@@ -49,7 +55,26 @@ namespace CF
             
             #endif
             
+            typedef enum
+            {
+                MapOptionNone       = 0x00,
+                MapOptionSequential = 0x01,
+                MapOptionRandom     = 0x02,
+                MapOptionWillNeed   = 0x04,
+                MapOptionPrefault   = 0x08
+            }
+            MapOption;
+            
             static Data Referencing( CFMutableDataRef cfObject );
+            static Data NoCopy( const Byte * bytes, CFIndex length, CFAllocatorRef deallocator );
+            static Data NoCopy( const Byte * bytes, CFIndex length, const std::function< void( const Byte * ) > & deallocator );
+            static Data MapFile( const std::string & path, CFOptionFlags options = MapOptionNone );
+            static Data FromBase64( const std::string & value );
+            static Data FromHex( const std::string & value );
+            static bool ToBase64( ReadStream & input, WriteStream & output );
+            static bool FromBase64( ReadStream & input, WriteStream & output );
+            static bool ToHex( ReadStream & input, WriteStream & output );
+            static bool FromHex( ReadStream & input, WriteStream & output );
             
             Data();
             Data( CFIndex capacity );
@@ -63,6 +88,8 @@ namespace CF
             Data( const Byte * value, CFIndex length );
             Data( std::initializer_list< Byte > value );
             Data( const std::vector< Byte > & value );
+            Data( std::string && value );
+            Data( std::vector< Byte > && value );
             Data( Data && value ) noexcept;
             
             ~Data() override;
@@ -87,21 +114,33 @@ namespace CF
             Data & operator += ( const Data & value );
             Data & operator += ( const std::string & value );
             Data & operator += ( const std::vector< Byte > & value );
+            Data & operator += ( const DataView & value );
             
             CFTypeID  GetTypeID()   const override;
             CFTypeRef GetCFObject() const override;
             
-            CFIndex      GetLength()                                                       const;
-            const Byte * GetBytePtr()                                                      const;
-            Byte       * GetMutableBytePtr()                                               const;
-            void         GetBytes( CFRange range, Byte * bytes )                           const;
-            CFRange      Find( const Data & data, CFRange range, CFDataSearchFlags flags ) const;
+            operator CFMutableDataRef () const override;
+            
+            CFIndex      GetLength()                                                                               const;
+            const Byte * GetBytePtr()                                                                              const;
+            void         GetBytes( CFRange range, Byte * bytes )                                                   const;
+            CFRange      Find( const Data & data, CFRange range, CFDataSearchFlags flags )                         const;
+            CFRange      FindAny( const std::vector< DataView > & data, CFRange range, CFIndex * index = nullptr ) const;
+            std::string  ToBase64()                                                                                const;
+            std::string  ToHex()                                                                                   const;
+            UInt32       GetCRC32C()                                                                               const;
+            UInt64       GetXXHash64( UInt64 seed = 0 )                                                            const;
+            Data         GetSHA256()                                                                               const;
             
+            Byte       * GetMutableBytePtr();
             void         SetLength( CFIndex length );
             void         IncreaseLength( CFIndex extraLength );
             void         AppendBytes( const Byte * bytes, CFIndex length );
+            void         AppendBytes( const DataView & bytes );
             void         ReplaceBytes( CFRange range, const Byte * newBytes, CFIndex newLength );
             void         DeleteBytes( CFRange range );
+            void         Reserve( CFIndex capacity );
+            void         ShrinkToFit();
             
             friend void swap( Data & v1, Data & v2 ) noexcept;
             
@@ -163,9 +202,54 @@ namespace CF
             Iterator begin() const;
             Iterator end()   const;
             
+            const Byte * cbegin()       const;
+            const Byte * cend()         const;
+            Byte       * MutableBegin();
+            Byte       * MutableEnd();
+            
+            class CFPP_EXPORT Appender
+            {
+                public:
+                    
+                    Appender( Data & data );
+                    Appender( Data & data, CFIndex capacity );
+                    
+                    Appender( const Appender & )              = delete;
+                    Appender & operator =( const Appender & ) = delete;
+                    
+                    virtual ~Appender();
+                    
+                    Appender & operator << ( Byte value );
+                    Appender & operator << ( const DataView & value );
+                    
+                    Appender & Append( const Byte * bytes, CFIndex length );
+                    CFIndex    GetLength() const;
+                    void       Commit();
+                    
+                private:
+                    
+                    void Grow( CFIndex length );
+                    
+                    Data  & _data;
+                    Byte  * _bp;
+                    CFIndex _base;
+                    CFIndex _length;
+                    CFIndex _capacity;
+            };
+            
         private:
             
-            CFMutableDataRef _cfObject;
+            struct Share;
+            
+            static Data Adopting( CFDataRef cfObject );
+            
+            void Detach()       const;
+            void ReleaseShare() const;
+            
+            mutable CFMutableDataRef       _cfObject;
+            mutable std::atomic< Share * > _share;
+            mutable bool                   _mutable;
+            mutable bool                   _unshareable;
     };
 }
 
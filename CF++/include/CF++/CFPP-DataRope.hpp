@@ -0,0 +1,90 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+/*!
+ * @header      CFPP-DataRope.h
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    CoreFoundation++ chunked byte buffer with logarithmic edits
+ */
+
+#ifndef CFPP_DATA_ROPE_HPP
+#define CFPP_DATA_ROPE_HPP
+
+namespace CF
+{
+    class CFPP_EXPORT DataRope
+    {
+        public:
+            
+            DataRope();
+            DataRope( const DataRope & value );
+            DataRope( const Data & value );
+            DataRope( const DataView & value );
+            DataRope( DataRope && value ) noexcept;
+            
+            virtual ~DataRope();
+            
+            DataRope & operator =( DataRope value );
+            
+            DataRope & operator += ( const Data & value );
+            DataRope & operator += ( const DataView & value );
+            DataRope & operator += ( const DataRope & value );
+            
+            Data::Byte operator [] ( CFIndex index ) const;
+            
+            CFIndex                 GetLength()                                   const;
+            CFIndex                 GetChunkCount()                               const;
+            bool                    IsEmpty()                                     const;
+            void                    GetBytes( CFRange range, Data::Byte * bytes ) const;
+            DataRope                Slice( CFRange range )                        const;
+            std::vector< DataView > GetChunks()                                   const;
+            Data                    GetData()                                     const;
+            bool                    Write( WriteStream & stream )                 const;
+            
+            void Append( const Data & data );
+            void Append( const DataView & data );
+            void Append( const DataRope & data );
+            void Insert( CFIndex location, const Data & data );
+            void Insert( CFIndex location, const DataView & data );
+            void Insert( CFIndex location, const DataRope & data );
+            void Delete( CFRange range );
+            void Replace( CFRange range, const Data & data );
+            void Replace( CFRange range, const DataView & data );
+            void Replace( CFRange range, const DataRope & data );
+            void Clear();
+            
+            friend void swap( DataRope & v1, DataRope & v2 ) noexcept;
+            
+        private:
+            
+            struct Node;
+            
+            DataRope( std::shared_ptr< const Node > root );
+            
+            std::shared_ptr< const Node > _root;
+    };
+}
+
+#endif /* CFPP_DATA_ROPE_HPP */
@@ -0,0 +1,103 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+/*!
+ * @header      CFPP-DataView.h
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    CoreFoundation++ non-owning view over CFDataRef bytes
+ */
+
+#ifndef CFPP_DATA_VIEW_HPP
+#define CFPP_DATA_VIEW_HPP
+
+#include <memory>
+
+namespace CF
+{
+    class CFPP_EXPORT DataView
+    {
+        public:
+            
+            static DataView Retaining( const Data & data );
+            static DataView Retaining( const Data & data, CFRange range );
+            
+            DataView();
+            DataView( const DataView & value );
+            DataView( const Data & data );
+            DataView( const Data & data, CFRange range );
+            DataView( const Data::Byte * bytes, CFIndex length );
+            DataView( DataView && value ) noexcept;
+            
+            #if __cplusplus >= 202002L
+            DataView( std::span< const Data::Byte > value );
+            #endif
+            
+            virtual ~DataView();
+            
+            DataView & operator =( DataView value );
+            
+            bool operator == ( const DataView & value ) const;
+            bool operator != ( const DataView & value ) const;
+            bool operator <  ( const DataView & value ) const;
+            
+            Data::Byte operator [] ( CFIndex index ) const;
+            
+            const Data::Byte * GetBytePtr()                                                                              const;
+            CFIndex            GetLength()                                                                               const;
+            bool               IsEmpty()                                                                                 const;
+            bool               IsRetaining()                                                                             const;
+            int                Compare( const DataView & value )                                                         const;
+            DataView           Slice( CFIndex location )                                                                 const;
+            DataView           Slice( CFRange range )                                                                    const;
+            CFRange            Find( const DataView & data )                                                             const;
+            CFRange            Find( const DataView & data, CFRange range, CFDataSearchFlags flags )                     const;
+            CFRange            FindAny( const std::vector< DataView > & data )                                           const;
+            CFRange            FindAny( const std::vector< DataView > & data, CFRange range, CFIndex * index = nullptr ) const;
+            bool               HasPrefix( const DataView & data )                                                        const;
+            bool               HasSuffix( const DataView & data )                                                        const;
+            Data               GetData()                                                                                 const;
+            
+            #if __cplusplus >= 202002L
+            std::span< const Data::Byte > GetSpan() const;
+            
+            operator std::span< const Data::Byte > () const;
+            #endif
+            
+            const Data::Byte * begin() const;
+            const Data::Byte * end()   const;
+            
+            friend void swap( DataView & v1, DataView & v2 ) noexcept;
+            
+        private:
+            
+            DataView( const Data::Byte * bytes, CFIndex length, std::shared_ptr< const Data > data );
+            
+            const Data::Byte              * _bp;
+            CFIndex                         _length;
+            std::shared_ptr< const Data >   _data;
+    };
+}
+
+#endif /* CFPP_DATA_VIEW_HPP */
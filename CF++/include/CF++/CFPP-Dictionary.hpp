@@ -62,35 +62,42 @@ namespace CF
             Dictionary & operator += ( const Pair & pair );
             Dictionary & operator << ( const Pair & pair );
             
-            CFTypeRef operator [] ( CFTypeRef key )      const;
-            CFTypeRef operator [] ( const char * key )   const;
-            CFTypeRef operator [] ( const String & key ) const;
+            CFTypeRef operator [] ( CFTypeRef key )            const;
+            CFTypeRef operator [] ( const char * key )         const;
+            CFTypeRef operator [] ( const String & key )       const;
+            CFTypeRef operator [] ( const StaticString & key ) const;
             
             CFTypeID  GetTypeID()   const override;
             CFTypeRef GetCFObject() const override;
             
-            bool      ContainsKey( CFTypeRef key )      const;
-            bool      ContainsKey( const char * key )   const;
-            bool      ContainsKey( const String & key ) const;
-            bool      ContainsValue( CFTypeRef value )  const;
-            CFIndex   GetCount()                        const;
-            CFTypeRef GetValue( CFTypeRef key )         const;
-            CFTypeRef GetValue( const char * key )      const;
-            CFTypeRef GetValue( const String & key )    const;
+            bool      ContainsKey( CFTypeRef key )            const;
+            bool      ContainsKey( const char * key )         const;
+            bool      ContainsKey( const String & key )       const;
+            bool      ContainsKey( const StaticString & key ) const;
+            bool      ContainsValue( CFTypeRef value )        const;
+            CFIndex   GetCount()                              const;
+            CFTypeRef GetValue( CFTypeRef key )               const;
+            CFTypeRef GetValue( const char * key )            const;
+            CFTypeRef GetValue( const String & key )          const;
+            CFTypeRef GetValue( const StaticString & key )    const;
             
             void RemoveAllValues();
             void AddValue( CFTypeRef key, CFTypeRef value );
             void AddValue( const char * key, CFTypeRef value );
             void AddValue( const String & key, CFTypeRef value );
+            void AddValue( const StaticString & key, CFTypeRef value );
             void RemoveValue( CFTypeRef key );
             void RemoveValue( const char * key );
             void RemoveValue( const String & key );
+            void RemoveValue( const StaticString & key );
             void ReplaceValue( CFTypeRef key, CFTypeRef value );
             void ReplaceValue( const char * key, CFTypeRef value );
             void ReplaceValue( const String & key, CFTypeRef value );
+            void ReplaceValue( const StaticString & key, CFTypeRef value );
             void SetValue( CFTypeRef key, CFTypeRef value );
             void SetValue( const char * key, CFTypeRef value );
             void SetValue( const String & key, CFTypeRef value );
+            void SetValue( const StaticString & key, CFTypeRef value );
             
             /*
              * To avoid implicit conversion from const char * to CFTypeRef - const void *
@@ -98,12 +105,15 @@ namespace CF
             void AddValue( CFTypeRef key, const char * value );
             void AddValue( const char * key, const char * value );
             void AddValue( const String & key, const char * value );
+            void AddValue( const StaticString & key, const char * value );
             void ReplaceValue( CFTypeRef key, const char * value );
             void ReplaceValue( const char * key, const char * value );
             void ReplaceValue( const String & key, const char * value );
+            void ReplaceValue( const StaticString & key, const char * value );
             void SetValue( CFTypeRef key, const char * value );
             void SetValue( const char * key, const char * value );
             void SetValue( const String & key, const char * value );
+            void SetValue( const StaticString & key, const char * value );
             
             friend void swap( Dictionary & v1, Dictionary & v2 ) noexcept;
             
@@ -0,0 +1,284 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      CFPP-Parallel.h
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Parallel algorithms over CF::Array
+ */
+
+#ifndef CFPP_PARALLEL_HPP
+#define CFPP_PARALLEL_HPP
+
+#include <vector>
+#include <type_traits>
+#include <utility>
+
+#ifndef CFPP_PARALLEL_MIN_CHUNK
+#define CFPP_PARALLEL_MIN_CHUNK     1024
+#endif
+
+#ifndef CFPP_PARALLEL_CHUNKS_PER_THREAD
+#define CFPP_PARALLEL_CHUNKS_PER_THREAD  4
+#endif
+
+#ifndef CFPP_PARALLEL_CACHE_LINE
+#define CFPP_PARALLEL_CACHE_LINE    64
+#endif
+
+namespace CF
+{
+    class CFPP_EXPORT Parallel
+    {
+        public:
+            
+            template< typename _F_ >
+            static void ForEach( const Array & array, _F_ function, ThreadPool & pool = ThreadPool::GetShared() )
+            {
+                std::vector< CFTypeRef > values( GetValues( array ) );
+                
+                Apply
+                (
+                    pool,
+                    values.size(),
+                    [ & ]( size_t chunk, size_t begin, size_t end )
+                    {
+                        ( void )chunk;
+                        
+                        for( size_t i = begin; i < end; i++ )
+                        {
+                            function( values[ i ] );
+                        }
+                    }
+                );
+            }
+            
+            template< typename _F_ >
+            static Array Map( const Array & array, _F_ function, ThreadPool & pool = ThreadPool::GetShared() )
+            {
+                using _R_ = typename std::decay< decltype( function( std::declval< CFTypeRef >() ) ) >::type;
+                
+                std::vector< CFTypeRef > values( GetValues( array ) );
+                std::vector< _R_ >       results( values.size() );
+                
+                Apply
+                (
+                    pool,
+                    values.size(),
+                    [ & ]( size_t chunk, size_t begin, size_t end )
+                    {
+                        ( void )chunk;
+                        
+                        for( size_t i = begin; i < end; i++ )
+                        {
+                            results[ i ] = function( values[ i ] );
+                            values[ i ]  = GetCFObject( results[ i ] );
+                        }
+                    }
+                );
+                
+                return Array( values.data(), static_cast< CFIndex >( values.size() ) );
+            }
+            
+            template< typename _F_ >
+            static Array Filter( const Array & array, _F_ predicate, ThreadPool & pool = ThreadPool::GetShared() )
+            {
+                std::vector< CFTypeRef >                 values( GetValues( array ) );
+                std::vector< std::vector< CFTypeRef > >  kept( GetChunkCount( values.size(), pool ) );
+                std::vector< CFTypeRef >                 results;
+                size_t                                   count;
+                
+                Apply
+                (
+                    pool,
+                    values.size(),
+                    [ & ]( size_t chunk, size_t begin, size_t end )
+                    {
+                        for( size_t i = begin; i < end; i++ )
+                        {
+                            if( predicate( values[ i ] ) )
+                            {
+                                kept[ chunk ].push_back( values[ i ] );
+                            }
+                        }
+                    }
+                );
+                
+                count = 0;
+                
+                for( const auto & k: kept )
+                {
+                    count += k.size();
+                }
+                
+                results.reserve( count );
+                
+                for( const auto & k: kept )
+                {
+                    results.insert( results.end(), k.begin(), k.end() );
+                }
+                
+                return Array( results.data(), static_cast< CFIndex >( results.size() ) );
+            }
+            
+            template< typename _T_, typename _F_, typename _C_ >
+            static _T_ Reduce( const Array & array, _T_ identity, _F_ reduce, _C_ combine, ThreadPool & pool = ThreadPool::GetShared() )
+            {
+                std::vector< CFTypeRef >      values( GetValues( array ) );
+                std::vector< Partial< _T_ > > partial( GetChunkCount( values.size(), pool ), Partial< _T_ >( identity ) );
+                _T_                           result( identity );
+                
+                Apply
+                (
+                    pool,
+                    values.size(),
+                    [ & ]( size_t chunk, size_t begin, size_t end )
+                    {
+                        _T_ value( identity );
+                        
+                        for( size_t i = begin; i < end; i++ )
+                        {
+                            value = reduce( std::move( value ), values[ i ] );
+                        }
+                        
+                        partial[ chunk ].value = std::move( value );
+                    }
+                );
+                
+                for( auto & p: partial )
+                {
+                    result = combine( std::move( result ), std::move( p.value ) );
+                }
+                
+                return result;
+            }
+            
+            template< typename _C_ >
+            static Array Sort( const Array & array, _C_ compare, ThreadPool & pool = ThreadPool::GetShared() )
+            {
+                std::vector< CFTypeRef > values( GetValues( array ) );
+                std::vector< CFTypeRef > buffer( values.size() );
+                std::vector< size_t >    bounds;
+                size_t                   chunks;
+                
+                chunks = GetChunkCount( values.size(), pool );
+                
+                for( size_t i = 0; i <= chunks; i++ )
+                {
+                    bounds.push_back( GetChunkBound( values.size(), chunks, i ) );
+                }
+                
+                Apply
+                (
+                    pool,
+                    values.size(),
+                    [ & ]( size_t chunk, size_t begin, size_t end )
+                    {
+                        ( void )chunk;
+                        
+                        std::sort( values.begin() + static_cast< ptrdiff_t >( begin ), values.begin() + static_cast< ptrdiff_t >( end ), compare );
+                    }
+                );
+                
+                /* Sorted runs are merged pairwise, each round in parallel, until a single run is left */
+                while( bounds.size() > 2 )
+                {
+                    std::vector< size_t > merged;
+                    size_t                runs;
+                    
+                    runs = bounds.size() - 1;
+                    
+                    pool.Run
+                    (
+                        ( runs + 1 ) / 2,
+                        [ & ]( size_t pair )
+                        {
+                            size_t first  = bounds[ pair * 2 ];
+                            size_t middle = bounds[ std::min( pair * 2 + 1, runs ) ];
+                            size_t last   = bounds[ std::min( pair * 2 + 2, runs ) ];
+                            
+                            std::merge
+                            (
+                                values.begin() + static_cast< ptrdiff_t >( first ),
+                                values.begin() + static_cast< ptrdiff_t >( middle ),
+                                values.begin() + static_cast< ptrdiff_t >( middle ),
+                                values.begin() + static_cast< ptrdiff_t >( last ),
+                                buffer.begin() + static_cast< ptrdiff_t >( first ),
+                                compare
+                            );
+                        }
+                    );
+                    
+                    for( size_t i = 0; i <= ( runs + 1 ) / 2; i++ )
+                    {
+                        merged.push_back( bounds[ std::min( i * 2, runs ) ] );
+                    }
+                    
+                    values.swap( buffer );
+                    bounds.swap( merged );
+                }
+                
+                return Array( values.data(), static_cast< CFIndex >( values.size() ) );
+            }
+            
+        private:
+            
+            /* Padded so that chunks storing their result don't share a cache line */
+            template< typename _T_ >
+            struct Partial
+            {
+                Partial( const _T_ & v ):
+                    value( v )
+                {}
+                
+                _T_  value;
+                char padding[ CFPP_PARALLEL_CACHE_LINE ];
+            };
+            
+            static std::vector< CFTypeRef > GetValues( const Array & array );
+            static size_t                   GetChunkCount( size_t count, const ThreadPool & pool );
+            static size_t                   GetChunkBound( size_t count, size_t chunks, size_t chunk );
+            static CFTypeRef                GetCFObject( const Type & value );
+            static CFTypeRef                GetCFObject( CFTypeRef value );
+            
+            template< typename _F_ >
+            static void Apply( ThreadPool & pool, size_t count, _F_ function )
+            {
+                size_t chunks;
+                
+                chunks = GetChunkCount( count, pool );
+                
+                pool.Run
+                (
+                    chunks,
+                    [ & ]( size_t chunk )
+                    {
+                        function( chunk, GetChunkBound( count, chunks, chunk ), GetChunkBound( count, chunks, chunk + 1 ) );
+                    }
+                );
+            }
+    };
+}
+
+#endif /* CFPP_PARALLEL_HPP */
@@ -86,6 +86,17 @@ namespace CF
         
         return ap.As< T >();
     }
+    
+    template < class T >
+    T PropertyListType< T >::FromPropertyListData( const DataView & plist )
+    {
+        if( plist.GetLength() == 0 )
+        {
+            return static_cast< CFTypeRef >( nullptr );
+        }
+        
+        return FromPropertyListData( Data::NoCopy( plist.GetBytePtr(), plist.GetLength(), []( const Data::Byte * ) {} ) );
+    }
 }
 
 #endif /* CFPP_PROPERTY_LIST_TYPE_DEFINITION_HPP */
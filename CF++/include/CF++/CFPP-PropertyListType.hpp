@@ -34,6 +34,7 @@
 namespace CF
 {
     class Data;
+    class DataView;
     
     template < class T >
     class CFPP_EXPORT PropertyListType: public PropertyListBase
@@ -43,6 +44,7 @@ namespace CF
             static T FromPropertyList( const std::string & path );
             static T FromPropertyListString( const std::string & plist );
             static T FromPropertyListData( const Data & plist );
+            static T FromPropertyListData( const DataView & plist );
     };
 }
 
@@ -0,0 +1,66 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+/*!
+ * @header      CFPP-SHA256.h
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    CoreFoundation++ incremental SHA-256 digest
+ */
+
+#ifndef CFPP_SHA256_HPP
+#define CFPP_SHA256_HPP
+
+namespace CF
+{
+    class CFPP_EXPORT SHA256
+    {
+        public:
+            
+            SHA256();
+            SHA256( const SHA256 & value );
+            SHA256( SHA256 && value ) noexcept;
+            
+            virtual ~SHA256();
+            
+            SHA256 & operator =( SHA256 value );
+            SHA256 & operator << ( const DataView & value );
+            
+            void Update( const Data::Byte * bytes, CFIndex length );
+            void Update( const DataView & data );
+            Data GetValue() const;
+            void Reset();
+            
+            friend void swap( SHA256 & v1, SHA256 & v2 ) noexcept;
+            
+        private:
+            
+            UInt32 _h[ 8 ];
+            UInt64 _total;
+            UInt8  _buffer[ 64 ];
+            size_t _bufferLength;
+    };
+}
+
+#endif /* CFPP_SHA256_HPP */
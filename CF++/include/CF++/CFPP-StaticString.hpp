@@ -0,0 +1,105 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      CFPP-StaticString.h
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    CoreFoundation++ wrapper for constant CFStringRef
+ */
+
+#ifndef CFPP_STATIC_STRING_HPP
+#define CFPP_STATIC_STRING_HPP
+
+/*
+ * Builds a CF::StaticString from a string literal.
+ * Uses compile-time constant strings when available (CFSTR), otherwise the
+ * string is created once, on first use, and never deallocated.
+ */
+#ifdef __CONSTANT_CFSTRINGS__
+#define CFPP_STR( s ) CF::StaticString::Constant( CFSTR( s ) )
+#else
+#define CFPP_STR( s ) CF::StaticString::Constant( [] () -> CFStringRef { static CFStringRef str = CF::StaticString::Create( "" s "" ); return str; }() )
+#endif
+
+namespace CF
+{
+    class CFPP_EXPORT StaticString: public Type
+    {
+        public:
+            
+            static CFStringRef  Create( const char * value );
+            static StaticString Constant( CFStringRef value );
+            
+            explicit StaticString( CFStringRef value );
+            StaticString( const StaticString & value );
+            
+            ~StaticString() override;
+            
+            StaticString & operator =( StaticString value );
+            
+            bool operator == ( const StaticString & value ) const;
+            bool operator != ( const StaticString & value ) const;
+            
+            CFTypeID  GetTypeID()   const override;
+            CFTypeRef GetCFObject() const override;
+            
+            CFIndex     GetLength() const;
+            std::string GetValue()  const;
+            
+            friend void swap( StaticString & v1, StaticString & v2 ) noexcept;
+            
+        private:
+            
+            CFStringRef _cfObject;
+            bool        _retained;
+    };
+    
+    #if defined( __cpp_nontype_template_args ) && __cpp_nontype_template_args >= 201911L
+    
+    namespace Literals
+    {
+        template< std::size_t N >
+        struct StaticStringLiteral
+        {
+            constexpr StaticStringLiteral( const char ( & s )[ N ] )
+            {
+                std::copy_n( s, N, this->value );
+            }
+            
+            char value[ N ];
+        };
+        
+        template< StaticStringLiteral S >
+        StaticString operator ""_cf()
+        {
+            static CFStringRef str = StaticString::Create( S.value );
+            
+            return StaticString::Constant( str );
+        }
+    }
+    
+    #endif
+}
+
+#endif /* CFPP_STATIC_STRING_HPP */
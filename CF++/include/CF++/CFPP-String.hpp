@@ -31,6 +31,8 @@
 #ifndef CFPP_STRING_HPP
 #define CFPP_STRING_HPP
 
+#include <atomic>
+
 namespace CF
 {
     class CFPP_EXPORT String: public PropertyListType< String >
@@ -98,10 +100,21 @@ namespace CF
             
             CFIndex GetLength() const;
             
-            std::string  GetValue( CFStringEncoding encoding = kCFStringEncodingUTF8 )        const;
-            const char * GetCStringValue( CFStringEncoding encoding = kCFStringEncodingUTF8 ) const;
+            std::string  GetValue( CFStringEncoding encoding = kCFStringEncodingUTF8 )                      const;
+            void         GetValue( std::string & value, CFStringEncoding encoding = kCFStringEncodingUTF8 ) const;
+            const char * GetCStringValue( CFStringEncoding encoding = kCFStringEncodingUTF8 )               const;
+            
+            #if __cplusplus >= 201703L
+            std::string_view GetView( CFStringEncoding encoding = kCFStringEncodingUTF8 ) const;
+            #endif
             
             void SetValue( const std::string & value, CFStringEncoding encoding = kCFStringEncodingUTF8 );
+            void Reserve( CFIndex capacity );
+            
+            String Intern() const;
+            
+            static CFIndex GetInternHitCount();
+            static CFIndex GetInternMissCount();
             
             friend void swap( String & v1, String & v2 ) noexcept;
             
@@ -152,20 +165,177 @@ namespace CF
                     
                     friend class String;
                     
-                    Iterator( CFStringRef string, CFStringEncoding encoding, CFIndex length, CFIndex pos = 0 );
+                    Iterator( CFStringRef string, const char * bytes, std::shared_ptr< const std::string > buffer, CFIndex length, CFIndex pos = 0 );
                     
-                    CFStringRef             _cfObject;
-                    CFIndex                 _length;
-                    CFIndex                 _pos;
-                    std::shared_ptr< char > _cp;
+                    CFStringRef                          _cfObject;
+                    CFIndex                              _length;
+                    CFIndex                              _pos;
+                    const char                         * _bp;
+                    std::shared_ptr< const std::string > _cp;
             };
             
             Iterator begin( CFStringEncoding encoding = kCFStringEncodingUTF8 ) const;
             Iterator end(   CFStringEncoding encoding = kCFStringEncodingUTF8 ) const;
             
+            class CFPP_EXPORT Token
+            {
+                public:
+                    
+                    Token();
+                    Token( const Token & value );
+                    
+                    virtual ~Token();
+                    
+                    Token & operator =( Token value );
+                    
+                    bool operator == ( const Token & value )       const;
+                    bool operator == ( const std::string & value ) const;
+                    bool operator == ( const char * value )        const;
+                    bool operator != ( const Token & value )       const;
+                    bool operator != ( const std::string & value ) const;
+                    bool operator != ( const char * value )        const;
+                    
+                    const char * GetBytes()  const;
+                    CFIndex      GetLength() const;
+                    std::string  GetValue()  const;
+                    String       GetString() const;
+                    
+                    #if __cplusplus >= 201703L
+                    std::string_view GetView() const;
+                    #endif
+                    
+                    friend void swap( Token & v1, Token & v2 ) noexcept;
+                    
+                private:
+                    
+                    friend class String;
+                    friend class SplitRange;
+                    
+                    Token( const char * bytes, CFIndex length, CFStringEncoding encoding );
+                    
+                    const char     * _bp;
+                    CFIndex          _length;
+                    CFStringEncoding _encoding;
+            };
+            
+            class CFPP_EXPORT SplitRange
+            {
+                private:
+                    
+                    struct State;
+                    
+                public:
+                    
+                    class CFPP_EXPORT Iterator
+                    {
+                        public:
+                            
+                            using iterator_category = std::forward_iterator_tag;
+                            using value_type        = Token;
+                            using difference_type   = ptrdiff_t;
+                            using pointer           = const Token *;
+                            using reference         = const Token &;
+                            
+                            Iterator();
+                            Iterator( const Iterator & value );
+                            
+                            virtual ~Iterator();
+                            
+                            Iterator & operator =( Iterator value );
+                            Iterator & operator ++();
+                            Iterator   operator ++( int );
+                            
+                            bool operator == ( const Iterator & value ) const;
+                            bool operator != ( const Iterator & value ) const;
+                            
+                            const Token & operator *()  const;
+                            const Token * operator ->() const;
+                            
+                            friend void swap( Iterator & v1, Iterator & v2 ) noexcept;
+                            
+                        private:
+                            
+                            friend class SplitRange;
+                            
+                            Iterator( std::shared_ptr< const State > state, CFIndex pos );
+                            
+                            void Next();
+                            
+                            std::shared_ptr< const State > _state;
+                            CFIndex                        _pos;
+                            CFIndex                        _next;
+                            Token                          _token;
+                    };
+                    
+                    SplitRange( const SplitRange & value );
+                    SplitRange( SplitRange && value ) noexcept;
+                    
+                    virtual ~SplitRange();
+                    
+                    SplitRange & operator =( SplitRange value );
+                    
+                    Iterator begin() const;
+                    Iterator end()   const;
+                    
+                    friend void swap( SplitRange & v1, SplitRange & v2 ) noexcept;
+                    
+                private:
+                    
+                    friend class String;
+                    
+                    struct State
+                    {
+                        State( CFStringRef string, const char * bytes, std::shared_ptr< const std::string > buffer, CFIndex length, const std::string & separator, CFStringEncoding encoding );
+                        State( const State & value ) = delete;
+                        
+                        ~State();
+                        
+                        State & operator =( const State & value ) = delete;
+                        
+                        CFStringRef                          _cfObject;
+                        const char                         * _bp;
+                        std::shared_ptr< const std::string > _cp;
+                        CFIndex                              _length;
+                        std::string                          _separator;
+                        CFStringEncoding                     _encoding;
+                    };
+                    
+                    SplitRange( CFStringRef string, const char * bytes, std::shared_ptr< const std::string > buffer, CFIndex length, const std::string & separator, CFStringEncoding encoding );
+                    
+                    std::shared_ptr< const State > _state;
+            };
+            
+            SplitRange Split( const String & separator, CFStringEncoding encoding = kCFStringEncodingUTF8 ) const;
+            
         private:
             
-            CFStringRef _cfObject;
+            friend class StringBuilder;
+            
+            struct Buffer;
+            struct Share;
+            
+            static Buffer * FindBuffer( Buffer * first, Buffer * last, CFStringEncoding encoding );
+            
+            void               Materialize()                                                                                                   const;
+            CFMutableStringRef GetMutableObject( CFIndex length );
+            void               ClearBuffers();
+            Share            * AcquireShare()                                                                                                  const;
+            void               ReleaseShare()                                                                                                  const;
+            bool               IsShared()                                                                                                      const;
+            const char       * GetEncodedBytes( CFStringEncoding encoding, CFIndex & length, std::shared_ptr< const std::string > * owner = nullptr ) const;
+            
+            mutable std::atomic< CFStringRef > _cfObject;
+            mutable std::atomic< Buffer * >    _buffers;
+            mutable std::atomic< Share * >     _share;
+            
+            union
+            {
+                CFIndex _capacity;
+                char    _inline[ 16 ];
+            };
+            
+            UInt8 _inlineLength;
+            bool  _mutable;
     };
 }
 
@@ -0,0 +1,85 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      CFPP-StringBuilder.h
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    CoreFoundation++ builder for CFMutableStringRef
+ */
+
+#ifndef CFPP_STRING_BUILDER_HPP
+#define CFPP_STRING_BUILDER_HPP
+
+namespace CF
+{
+    class CFPP_EXPORT StringBuilder
+    {
+        public:
+            
+            StringBuilder();
+            StringBuilder( CFIndex capacity );
+            StringBuilder( const StringBuilder & value );
+            StringBuilder( StringBuilder && value ) noexcept;
+            
+            virtual ~StringBuilder();
+            
+            StringBuilder & operator =( StringBuilder value );
+            
+            StringBuilder & operator << ( const String & value );
+            StringBuilder & operator << ( CFStringRef value );
+            StringBuilder & operator << ( const std::string & value );
+            StringBuilder & operator << ( const char * value );
+            StringBuilder & operator << ( char value );
+            StringBuilder & operator << ( bool value );
+            StringBuilder & operator << ( signed int value );
+            StringBuilder & operator << ( signed long value );
+            StringBuilder & operator << ( signed long long value );
+            StringBuilder & operator << ( unsigned int value );
+            StringBuilder & operator << ( unsigned long value );
+            StringBuilder & operator << ( unsigned long long value );
+            StringBuilder & operator << ( double value );
+            StringBuilder & operator << ( const Number & value );
+            StringBuilder & operator << ( const Date & value );
+            
+            StringBuilder & Append( const char * value, size_t length );
+            
+            CFIndex GetLength() const;
+            String  GetString() const;
+            
+            void Reserve( CFIndex capacity );
+            void Clear();
+            
+            friend void swap( StringBuilder & v1, StringBuilder & v2 ) noexcept;
+            
+        private:
+            
+            void AppendCharacters( const UniChar * chars, CFIndex length );
+            void AppendSigned( signed long long value );
+            void AppendUnsigned( unsigned long long value );
+            
+            String _string;
+    };
+}
+
+#endif /* CFPP_STRING_BUILDER_HPP */
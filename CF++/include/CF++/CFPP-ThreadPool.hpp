@@ -0,0 +1,78 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      CFPP-ThreadPool.h
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Work-stealing thread pool used by CF::Parallel
+ */
+
+#ifndef CFPP_THREAD_POOL_HPP
+#define CFPP_THREAD_POOL_HPP
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+
+namespace CF
+{
+    class CFPP_EXPORT ThreadPool
+    {
+        public:
+            
+            ThreadPool();
+            ThreadPool( size_t threads );
+            ThreadPool( const ThreadPool & value ) = delete;
+            
+            virtual ~ThreadPool();
+            
+            ThreadPool & operator =( const ThreadPool & value ) = delete;
+            
+            static ThreadPool & GetShared();
+            
+            size_t GetThreadCount() const;
+            
+            void Run( size_t count, const std::function< void( size_t ) > & task );
+            
+        private:
+            
+            struct Batch;
+            struct Queue;
+            
+            void Work( size_t index );
+            bool Execute( size_t index );
+            
+            std::vector< std::thread >              _threads;
+            std::vector< std::unique_ptr< Queue > > _queues;
+            std::mutex                              _mutex;
+            std::condition_variable                 _condition;
+            std::atomic< size_t >                   _pending;
+            std::atomic< size_t >                   _next;
+            bool                                    _stop;
+    };
+}
+
+#endif /* CFPP_THREAD_POOL_HPP */
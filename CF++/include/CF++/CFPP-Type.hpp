@@ -60,9 +60,7 @@ namespace CF
             operator CFMutableStringRef     () const;
             operator CFURLRef               () const;
             operator CFDataRef              () const;
-            operator CFMutableDataRef       () const;
             operator CFArrayRef             () const;
-            operator CFMutableArrayRef      () const;
             operator CFDictionaryRef        () const;
             operator CFMutableDictionaryRef () const;
             operator CFUUIDRef              () const;
@@ -70,6 +68,9 @@ namespace CF
             operator CFReadStreamRef        () const;
             operator CFWriteStreamRef       () const;
             
+            virtual operator CFMutableDataRef  () const;
+            virtual operator CFMutableArrayRef () const;
+            
             std::string Description()    const;
             CFHashCode  Hash()           const;
             void        Show()           const;
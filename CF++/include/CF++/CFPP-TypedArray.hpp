@@ -0,0 +1,389 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+/*!
+ * @header      CFPP-TypedArray.h
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    CoreFoundation++ homogeneous CFArrayRef wrapper
+ */
+
+#ifndef CFPP_TYPED_ARRAY_HPP
+#define CFPP_TYPED_ARRAY_HPP
+
+namespace CF
+{
+    template< typename _T_ >
+    struct TypedArrayTraits;
+    
+    template<> struct TypedArrayTraits< String >     { typedef CFStringRef     Reference; };
+    template<> struct TypedArrayTraits< Number >     { typedef CFNumberRef     Reference; };
+    template<> struct TypedArrayTraits< Boolean >    { typedef CFBooleanRef    Reference; };
+    template<> struct TypedArrayTraits< Data >       { typedef CFDataRef       Reference; };
+    template<> struct TypedArrayTraits< Date >       { typedef CFDateRef       Reference; };
+    template<> struct TypedArrayTraits< URL >        { typedef CFURLRef        Reference; };
+    template<> struct TypedArrayTraits< Array >      { typedef CFArrayRef      Reference; };
+    template<> struct TypedArrayTraits< Dictionary > { typedef CFDictionaryRef Reference; };
+    template<> struct TypedArrayTraits< Error >      { typedef CFErrorRef      Reference; };
+    template<> struct TypedArrayTraits< UUID >       { typedef CFUUIDRef       Reference; };
+    
+    template< typename _T_ >
+    class TypedArray: public Array
+    {
+        public:
+            
+            typedef typename TypedArrayTraits< _T_ >::Reference Reference;
+            
+            static CFTypeID GetElementTypeID()
+            {
+                static const CFTypeID typeID = _T_( nullptr ).GetTypeID();
+                
+                return typeID;
+            }
+            
+            TypedArray(): Array()
+            {}
+            
+            TypedArray( CFIndex capacity ): Array( capacity )
+            {}
+            
+            TypedArray( const TypedArray< _T_ > & value ): Array( value )
+            {}
+            
+            TypedArray( const Array & value ): Array( value )
+            {
+                this->Validate();
+            }
+            
+            TypedArray( const AutoPointer & value ): Array( value )
+            {
+                this->Validate();
+            }
+            
+            TypedArray( CFTypeRef value ): Array( value )
+            {
+                this->Validate();
+            }
+            
+            TypedArray( CFArrayRef value ): Array( value )
+            {
+                this->Validate();
+            }
+            
+            TypedArray( std::nullptr_t ): Array( nullptr )
+            {}
+            
+            TypedArray( std::initializer_list< _T_ > value ): Array( static_cast< CFIndex >( value.size() ) )
+            {
+                this->AppendValues( value.begin(), value.end() );
+            }
+            
+            TypedArray( const std::vector< _T_ > & value ): Array( static_cast< CFIndex >( value.size() ) )
+            {
+                this->AppendValues( value.begin(), value.end() );
+            }
+            
+            TypedArray( TypedArray< _T_ > && value ) noexcept: Array( std::move( value ) )
+            {}
+            
+            TypedArray< _T_ > & operator =( TypedArray< _T_ > value )
+            {
+                swap( *( this ), value );
+                
+                return *( this );
+            }
+            
+            TypedArray< _T_ > & operator += ( const TypedArray< _T_ > & value )
+            {
+                this->AppendArray( value );
+                
+                return *( this );
+            }
+            
+            TypedArray< _T_ > & operator << ( const _T_ & value )
+            {
+                this->AppendValue( value );
+                
+                return *( this );
+            }
+            
+            Reference operator [] ( int index ) const
+            {
+                return this->GetValueAtIndex( static_cast< CFIndex >( index ) );
+            }
+            
+            Reference GetValueAtIndex( CFIndex index ) const
+            {
+                return Cast( Array::GetValueAtIndex( index ) );
+            }
+            
+            void SetValueAtIndex( const _T_ & value, CFIndex index )
+            {
+                if( value.IsValid() )
+                {
+                    Array::SetValueAtIndex( value.GetCFObject(), index );
+                }
+            }
+            
+            void InsertValueAtIndex( const _T_ & value, CFIndex index )
+            {
+                if( value.IsValid() )
+                {
+                    Array::InsertValueAtIndex( value.GetCFObject(), index );
+                }
+            }
+            
+            void AppendValue( const _T_ & value )
+            {
+                if( value.IsValid() )
+                {
+                    Array::AppendValue( value.GetCFObject() );
+                }
+            }
+            
+            void AppendArray( const TypedArray< _T_ > & value )
+            {
+                Array::AppendArray( static_cast< CFArrayRef >( value.GetCFObject() ) );
+            }
+            
+            template< typename InputIterator, typename = typename std::enable_if< ArrayValueTraits< typename std::iterator_traits< InputIterator >::value_type >::IsValue >::type >
+            void AppendValues( InputIterator first, InputIterator last )
+            {
+                std::vector< CFTypeRef > values;
+                CFTypeRef                value;
+                
+                ReserveValues( values, first, last, typename std::iterator_traits< InputIterator >::iterator_category() );
+                
+                for( ; first != last; ++first )
+                {
+                    value = RetainValue( static_cast< CFTypeRef >( *( first ) ) );
+                    
+                    if( value != nullptr && CFGetTypeID( value ) != GetElementTypeID() )
+                    {
+                        CFRelease( value );
+                        
+                        continue;
+                    }
+                    
+                    values.push_back( value );
+                }
+                
+                Array::AppendValues( values.data(), static_cast< CFIndex >( values.size() ) );
+                ReleaseValues( values );
+            }
+            
+            friend void swap( TypedArray< _T_ > & v1, TypedArray< _T_ > & v2 ) noexcept
+            {
+                swap( static_cast< Array & >( v1 ), static_cast< Array & >( v2 ) );
+            }
+            
+            class Iterator
+            {
+                public:
+                    
+                    using iterator_category = std::random_access_iterator_tag;
+                    using value_type        = Reference;
+                    using difference_type   = ptrdiff_t;
+                    using pointer           = const Reference *;
+                    using reference         = Reference;
+                    
+                    Iterator():
+                        _cfObject( nullptr ),
+                        _pos( 0 )
+                    {}
+                    
+                    Iterator & operator ++()
+                    {
+                        this->_pos++;
+                        
+                        return *( this );
+                    }
+                    
+                    Iterator operator ++( int )
+                    {
+                        Iterator it( *( this ) );
+                        
+                        operator++();
+                        
+                        return it;
+                    }
+                    
+                    Iterator & operator --()
+                    {
+                        this->_pos--;
+                        
+                        return *( this );
+                    }
+                    
+                    Iterator operator --( int )
+                    {
+                        Iterator it( *( this ) );
+                        
+                        operator--();
+                        
+                        return it;
+                    }
+                    
+                    Iterator & operator += ( CFIndex value )
+                    {
+                        this->_pos += value;
+                        
+                        return *( this );
+                    }
+                    
+                    Iterator & operator -= ( CFIndex value )
+                    {
+                        this->_pos -= value;
+                        
+                        return *( this );
+                    }
+                    
+                    Iterator operator +( CFIndex value ) const
+                    {
+                        return Iterator( this->_cfObject, this->_pos + value );
+                    }
+                    
+                    Iterator operator -( CFIndex value ) const
+                    {
+                        return Iterator( this->_cfObject, this->_pos - value );
+                    }
+                    
+                    ptrdiff_t operator -( const Iterator & value ) const
+                    {
+                        return static_cast< ptrdiff_t >( this->_pos - value._pos );
+                    }
+                    
+                    bool operator == ( const Iterator & value ) const
+                    {
+                        return this->_cfObject == value._cfObject && this->_pos == value._pos;
+                    }
+                    
+                    bool operator != ( const Iterator & value ) const
+                    {
+                        return !( *( this ) == value );
+                    }
+                    
+                    bool operator < ( const Iterator & value ) const
+                    {
+                        return this->_pos < value._pos;
+                    }
+                    
+                    bool operator > ( const Iterator & value ) const
+                    {
+                        return this->_pos > value._pos;
+                    }
+                    
+                    bool operator <= ( const Iterator & value ) const
+                    {
+                        return this->_pos <= value._pos;
+                    }
+                    
+                    bool operator >= ( const Iterator & value ) const
+                    {
+                        return this->_pos >= value._pos;
+                    }
+                    
+                    Reference operator *() const
+                    {
+                        return TypedArray< _T_ >::Cast( CFArrayGetValueAtIndex( this->_cfObject, this->_pos ) );
+                    }
+                    
+                    Reference operator []( CFIndex index ) const
+                    {
+                        return TypedArray< _T_ >::Cast( CFArrayGetValueAtIndex( this->_cfObject, this->_pos + index ) );
+                    }
+                    
+                    friend Iterator operator +( CFIndex v1, const Iterator & v2 )
+                    {
+                        return v2 + v1;
+                    }
+                    
+                private:
+                    
+                    friend class TypedArray< _T_ >;
+                    
+                    Iterator( CFArrayRef array, CFIndex pos ):
+                        _cfObject( array ),
+                        _pos( pos )
+                    {}
+                    
+                    CFArrayRef _cfObject;
+                    CFIndex    _pos;
+            };
+            
+            Iterator begin() const
+            {
+                return Iterator( this->_cfObject, 0 );
+            }
+            
+            Iterator end() const
+            {
+                return Iterator( this->_cfObject, this->GetCount() );
+            }
+            
+        private:
+            
+            /*
+             * The array can still be changed through a CF::Array reference or
+             * its CFMutableArrayRef, so values are checked again when read.
+             */
+            static Reference Cast( CFTypeRef value )
+            {
+                if( value == nullptr || CFGetTypeID( value ) != GetElementTypeID() )
+                {
+                    return nullptr;
+                }
+                
+                return static_cast< Reference >( value );
+            }
+            
+            void Validate()
+            {
+                CFIndex   i;
+                CFIndex   count;
+                CFTypeRef value;
+                
+                if( this->_cfObject == nullptr )
+                {
+                    return;
+                }
+                
+                count = CFArrayGetCount( this->_cfObject );
+                
+                for( i = 0; i < count; i++ )
+                {
+                    value = CFArrayGetValueAtIndex( this->_cfObject, i );
+                    
+                    if( value == nullptr || CFGetTypeID( value ) != GetElementTypeID() )
+                    {
+                        Array::operator =( nullptr );
+                        
+                        return;
+                    }
+                }
+            }
+    };
+}
+
+#endif /* CFPP_TYPED_ARRAY_HPP */
@@ -72,8 +72,10 @@ namespace CF
             
             CFIndex Write( const Data::Byte * buffer, CFIndex length );
             CFIndex Write( const Data & data );
+            CFIndex Write( const DataView & data );
             bool    WriteAll( const Data::Byte * buffer, CFIndex length );
             bool    WriteAll( const Data & data );
+            bool    WriteAll( const DataView & data );
             bool    SetProperty( const String & name, CFTypeRef value );
             bool    SetClient( CFOptionFlags events, CFWriteStreamClientCallBack callback, CFStreamClientContext * context );
             void    ScheduleWithRunLoop( CFRunLoopRef runLoop, CF::String mode );
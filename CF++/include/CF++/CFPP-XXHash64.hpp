@@ -0,0 +1,68 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+/*!
+ * @header      CFPP-XXHash64.h
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    CoreFoundation++ incremental XXH64 hash
+ */
+
+#ifndef CFPP_XXHASH64_HPP
+#define CFPP_XXHASH64_HPP
+
+namespace CF
+{
+    class CFPP_EXPORT XXHash64
+    {
+        public:
+            
+            XXHash64();
+            XXHash64( UInt64 seed );
+            XXHash64( const XXHash64 & value );
+            XXHash64( XXHash64 && value ) noexcept;
+            
+            virtual ~XXHash64();
+            
+            XXHash64 & operator =( XXHash64 value );
+            XXHash64 & operator << ( const DataView & value );
+            
+            void   Update( const Data::Byte * bytes, CFIndex length );
+            void   Update( const DataView & data );
+            UInt64 GetValue() const;
+            void   Reset();
+            
+            friend void swap( XXHash64 & v1, XXHash64 & v2 ) noexcept;
+            
+        private:
+            
+            UInt64 _seed;
+            UInt64 _v[ 4 ];
+            UInt64 _total;
+            UInt8  _buffer[ 32 ];
+            size_t _bufferLength;
+    };
+}
+
+#endif /* CFPP_XXHASH64_HPP */
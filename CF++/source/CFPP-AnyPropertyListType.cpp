@@ -60,6 +60,16 @@ namespace CF
         return { ap, ( f == kCFPropertyListBinaryFormat_v1_0 ) ? PropertyListFormatBinary : PropertyListFormatXML };
     }
     
+    AnyPropertyListType AnyPropertyListType::FromPropertyListData( const DataView & plist )
+    {
+        if( plist.GetLength() == 0 )
+        {
+            return { static_cast< CFTypeRef >( nullptr ), PropertyListFormatBinary };
+        }
+        
+        return FromPropertyListData( Data::NoCopy( plist.GetBytePtr(), plist.GetLength(), []( const Data::Byte * ) {} ) );
+    }
+    
     AnyPropertyListType AnyPropertyListType::FromPropertyListString( const std::string & plist )
     {
         if( plist.length() == 0 )
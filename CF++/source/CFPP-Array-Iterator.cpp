@@ -31,52 +31,84 @@
 #include <CF++.hpp>
 
 namespace CF
-{    
+{
+    /*
+     * Values are fetched once with CFArrayGetValues, so dereferencing and
+     * copying an iterator never touch the CF refcount.
+     * The snapshot holds a copy of the Array, which shares the CFArray and
+     * makes the original detach before its next mutation, so the values stay
+     * alive for as long as an iterator from begin() does.
+     * Iterators from end() carry no snapshot. Like std::vector::end(), they
+     * are invalidated by any mutation of the array.
+     */
+    struct Array::Iterator::Snapshot
+    {
+        Snapshot( const Array & value ): array( value )
+        {}
+        
+        Snapshot( const Snapshot & value )              = delete;
+        Snapshot & operator =( const Snapshot & value ) = delete;
+        
+        Array                    array;
+        std::vector< CFTypeRef > values;
+    };
+    
     Array::Iterator::Iterator():
+        _snapshot( nullptr ),
         _cfObject( nullptr ),
+        _values( nullptr ),
         _count( 0 ),
         _pos( 0 )
     {}
     
     Array::Iterator::Iterator( const Iterator & value ):
+        _snapshot( value._snapshot ),
         _cfObject( value._cfObject ),
+        _values( value._values ),
         _count( value._count ),
         _pos( value._pos )
-    {
-        if( this->_cfObject != nullptr )
-        {
-            CFRetain( this->_cfObject );
-        }
-    }
+    {}
     
-    Array::Iterator::Iterator( CFArrayRef array, CFIndex count, CFIndex pos ):
-        _cfObject( array ),
-        _count( count ),
+    Array::Iterator::Iterator( const Array & array, CFIndex pos, bool snapshot ):
+        _snapshot( nullptr ),
+        _cfObject( array._cfObject ),
+        _values( nullptr ),
+        _count( array.GetCount() ),
         _pos( pos )
     {
-        if( this->_cfObject != nullptr )
+        if( this->_cfObject == nullptr || snapshot == false || this->_count == 0 )
         {
-            CFRetain( this->_cfObject );
+            return;
         }
+        
+        /*
+         * _cfObject stays the original array, so iterators compare equal to
+         * end() even when the copy of a referenced array is a deep one.
+         */
+        this->_snapshot = std::make_shared< Snapshot >( array );
+        
+        this->_snapshot->values.resize( static_cast< size_t >( this->_count ) );
+        
+        CFArrayGetValues( this->_snapshot->array._cfObject, CFRangeMake( 0, this->_count ), this->_snapshot->values.data() );
+        
+        this->_values = this->_snapshot->values.data();
     }
     
-    Array::Iterator::Iterator( Iterator && value ) noexcept
+    Array::Iterator::Iterator( Iterator && value ) noexcept:
+        _snapshot( std::move( value._snapshot ) ),
+        _cfObject( value._cfObject ),
+        _values( value._values ),
+        _count( value._count ),
+        _pos( value._pos )
     {
-        this->_cfObject = value._cfObject;
         value._cfObject = nullptr;
-        this->_count    = value._count;
+        value._values   = nullptr;
         value._count    = 0;
-        this->_pos      = value._pos;
         value._pos      = 0;
     }
     
     Array::Iterator::~Iterator()
-    {
-        if( this->_cfObject != nullptr )
-        {
-            CFRelease( this->_cfObject );
-        }
-    }
+    {}
     
     Array::Iterator & Array::Iterator::operator =( Iterator value )
     {
@@ -131,24 +163,25 @@ namespace CF
         return *( this );
     }
     
-    Array::Iterator Array::Iterator::operator +( CFIndex value )
+    Array::Iterator Array::Iterator::operator +( CFIndex value ) const
     {
-        Iterator i;
-        
-        i = *( this );
+        Iterator i( *( this ) );
         
         return i += value;
     }
     
-    Array::Iterator Array::Iterator::operator -( CFIndex value )
+    Array::Iterator Array::Iterator::operator -( CFIndex value ) const
     {
-        Iterator i;
-        
-        i = *( this );
+        Iterator i( *( this ) );
         
         return i -= value;
     }
     
+    ptrdiff_t Array::Iterator::operator -( const Iterator & value ) const
+    {
+        return static_cast< ptrdiff_t >( this->_pos - value._pos );
+    }
+    
     bool Array::Iterator::operator == ( const Iterator & value ) const
     {
         if( this->_cfObject != value._cfObject )
@@ -174,9 +207,34 @@ namespace CF
         return !( *( this ) == value );
     }
     
+    bool Array::Iterator::operator < ( const Iterator & value ) const
+    {
+        return this->_pos < value._pos;
+    }
+    
+    bool Array::Iterator::operator > ( const Iterator & value ) const
+    {
+        return this->_pos > value._pos;
+    }
+    
+    bool Array::Iterator::operator <= ( const Iterator & value ) const
+    {
+        return this->_pos <= value._pos;
+    }
+    
+    bool Array::Iterator::operator >= ( const Iterator & value ) const
+    {
+        return this->_pos >= value._pos;
+    }
+    
     CFTypeRef Array::Iterator::operator *() const
     {
-        return this->GetCFObject();
+        return this->GetValueAtIndex( this->_pos );
+    }
+    
+    CFTypeRef Array::Iterator::operator []( CFIndex index ) const
+    {
+        return this->GetValueAtIndex( this->_pos + index );
     }
     
     Array::Iterator::operator CFTypeRef () const
@@ -199,35 +257,43 @@ namespace CF
     }
     
     CFTypeRef Array::Iterator::GetCFObject() const
+    {
+        return this->GetValueAtIndex( this->_pos );
+    }
+    
+    CFTypeRef Array::Iterator::GetValueAtIndex( CFIndex index ) const
     {
         if( this->_cfObject == nullptr )
         {
             return nullptr;
         }
         
-        if( this->_count == 0 )
+        if( index < 0 || index >= this->_count )
         {
             return nullptr;
         }
         
-        if( this->_pos >= this->_count )
+        /* Iterators obtained from end() carry no values */
+        if( this->_values == nullptr )
         {
-            return nullptr;
+            return CFArrayGetValueAtIndex( this->_cfObject, index );
         }
         
-        if( this->_pos < 0 )
-        {
-            return nullptr;
-        }
-        
-        return CFArrayGetValueAtIndex( this->_cfObject, this->_pos );
+        return this->_values[ index ];
+    }
+    
+    Array::Iterator operator +( CFIndex v1, const Array::Iterator & v2 )
+    {
+        return v2 + v1;
     }
     
     void swap( Array::Iterator & v1, Array::Iterator & v2 ) noexcept
     {
         using std::swap;
         
+        swap( v1._snapshot, v2._snapshot );
         swap( v1._cfObject, v2._cfObject );
+        swap( v1._values,   v2._values );
         swap( v1._count,    v2._count );
         swap( v1._pos,      v2._pos );
     }
@@ -34,6 +34,12 @@ static bool __hasCallBacks = false;
 
 static CFArrayCallBacks __callbacks;
 
+static void __CFArrayApplierFunction( const void * value, void * context );
+static void __CFArrayApplierFunction( const void * value, void * context )
+{
+    ( *( static_cast< const std::function< void( CFTypeRef ) > * >( context ) ) )( value );
+}
+
 #ifdef _WIN32
 
 static const void *    __CFArrayRetainCallBack( CFAllocatorRef allocator, const void * value );
@@ -120,6 +126,14 @@ static void __createCallbacks()
 
 namespace CF
 {
+    struct Array::Share
+    {
+        Share( CFIndex value ): count( value )
+        {}
+        
+        std::atomic< CFIndex > count;
+    };
+    
     Array Array::Referencing( CFMutableArrayRef cfObject )
     {
         if( cfObject == nullptr )
@@ -129,12 +143,17 @@ namespace CF
         
         CF::Array array( nullptr );
         
-        array._cfObject = static_cast< CFMutableArrayRef >( const_cast< void * >( CFRetain( cfObject ) ) );
+        array._cfObject    = static_cast< CFMutableArrayRef >( const_cast< void * >( CFRetain( cfObject ) ) );
+        array._unshareable = true;
         
         return array;
     }
     
-    Array::Array(): _cfObject( nullptr )
+    Array::Array():
+        _cfObject( nullptr ),
+        _share( nullptr ),
+        _mutable( true ),
+        _unshareable( false )
     {
         __createCallbacks();
         
@@ -146,7 +165,11 @@ namespace CF
         );
     }
     
-    Array::Array( CFIndex capacity ): _cfObject( nullptr )
+    Array::Array( CFIndex capacity ):
+        _cfObject( nullptr ),
+        _share( nullptr ),
+        _mutable( true ),
+        _unshareable( false )
     {
         __createCallbacks();
         
@@ -158,22 +181,67 @@ namespace CF
         );
     }
     
-    Array::Array( const Array & value ): _cfObject( nullptr )
+    Array::Array( const Array & value ):
+        _cfObject( nullptr ),
+        _share( nullptr ),
+        _mutable( true ),
+        _unshareable( false )
     {
+        Share * share;
+        Share * expected;
+        
         __createCallbacks();
         
-        if( value._cfObject != nullptr )
+        if( value._cfObject == nullptr )
+        {
+            return;
+        }
+        
+        /* A referenced CFMutableArray may be changed by its owner, so it's copied */
+        if( value._unshareable )
         {
             this->_cfObject = CFArrayCreateMutableCopy
             (
                 static_cast< CFAllocatorRef >( nullptr ),
-                CFArrayGetCount( value._cfObject ),
+                0,
                 value._cfObject
             );
+            
+            return;
         }
+        
+        /*
+         * The share count is created by the first copy, and published with a
+         * CAS since the source may be copied from several threads at once.
+         * The source holds the initial reference.
+         */
+        share = value._share.load( std::memory_order_acquire );
+        
+        if( share == nullptr )
+        {
+            share    = new Share( 1 );
+            expected = nullptr;
+            
+            if( value._share.compare_exchange_strong( expected, share, std::memory_order_acq_rel ) == false )
+            {
+                delete share;
+                
+                share = expected;
+            }
+        }
+        
+        share->count.fetch_add( 1, std::memory_order_relaxed );
+        
+        this->_cfObject = static_cast< CFMutableArrayRef >( const_cast< void * >( CFRetain( value._cfObject ) ) );
+        this->_share    = share;
+        this->_mutable  = value._mutable;
     }
     
-    Array::Array( const AutoPointer & value ): _cfObject( nullptr )
+    Array::Array( const AutoPointer & value ):
+        _cfObject( nullptr ),
+        _share( nullptr ),
+        _mutable( true ),
+        _unshareable( false )
     {
         __createCallbacks();
         
@@ -182,13 +250,17 @@ namespace CF
             this->_cfObject = CFArrayCreateMutableCopy
             (
                 static_cast< CFAllocatorRef >( nullptr ),
-                CFArrayGetCount( value ),
-                value
+                0,
+                static_cast< CFArrayRef >( value.GetCFObject() )
             );
         }
     }
     
-    Array::Array( CFTypeRef value ): _cfObject( nullptr )
+    Array::Array( CFTypeRef value ):
+        _cfObject( nullptr ),
+        _share( nullptr ),
+        _mutable( true ),
+        _unshareable( false )
     {
         __createCallbacks();
         
@@ -203,7 +275,11 @@ namespace CF
         }
     }
     
-    Array::Array( CFArrayRef value ): _cfObject( nullptr )
+    Array::Array( CFArrayRef value ):
+        _cfObject( nullptr ),
+        _share( nullptr ),
+        _mutable( true ),
+        _unshareable( false )
     {
         __createCallbacks();
         
@@ -221,25 +297,40 @@ namespace CF
     Array::Array( std::nullptr_t ): Array( static_cast< CFTypeRef >( nullptr ) )
     {}
     
-    Array::Array( std::initializer_list< CFTypeRef > value ): Array( static_cast< CFIndex >( value.size() ) )
+    Array::Array( std::initializer_list< CFTypeRef > value ): Array( value.begin(), static_cast< CFIndex >( value.size() ) )
+    {}
+    
+    Array::Array( const CFTypeRef * values, CFIndex count ): Array( count )
     {
-        for( CFTypeRef o: value )
-        {
-            if( o != nullptr )
-            {
-                CFArrayAppendValue( this->_cfObject, o );
-            }
-        }
+        this->AppendValues( values, count );
     }
     
-    Array::Array( Array && value ) noexcept
+    Array::Array( const std::vector< CFTypeRef > & value ): Array( value.data(), static_cast< CFIndex >( value.size() ) )
+    {}
+    
+    Array::Array( const std::vector< String > & value ): Array( value.begin(), value.end() )
+    {}
+    
+    #if __cplusplus >= 202002L
+    Array::Array( std::span< const CFTypeRef > value ): Array( value.data(), static_cast< CFIndex >( value.size() ) )
+    {}
+    #endif
+    
+    Array::Array( Array && value ) noexcept:
+        _cfObject( value._cfObject ),
+        _share( value._share.exchange( nullptr ) ),
+        _mutable( value._mutable ),
+        _unshareable( value._unshareable )
     {
-        this->_cfObject = value._cfObject;
-        value._cfObject = nullptr;
+        value._cfObject    = nullptr;
+        value._mutable     = true;
+        value._unshareable = false;
     }
     
     Array::~Array()
     {
+        this->ReleaseShare();
+        
         if( this->_cfObject != nullptr )
         {
             CFRelease( this->_cfObject );
@@ -309,6 +400,11 @@ namespace CF
         return operator <<( value.GetCFObject() );
     }
     
+    Array & Array::operator << ( const StaticString & value )
+    {
+        return operator <<( value.GetCFObject() );
+    }
+    
     Array & Array::operator << ( const Number & value )
     {
         return operator <<( value.GetCFObject() );
@@ -329,6 +425,24 @@ namespace CF
         return this->_cfObject;
     }
     
+    Array::operator CFMutableArrayRef () const
+    {
+        if( this->_cfObject == nullptr )
+        {
+            return nullptr;
+        }
+        
+        /*
+         * The caller may mutate the object directly, so it's detached from
+         * any copy and never shared again.
+         */
+        this->Detach();
+        
+        this->_unshareable = true;
+        
+        return this->_cfObject;
+    }
+    
     CFIndex Array::GetCount() const
     {
         return ( this->_cfObject == nullptr ) ? 0 : CFArrayGetCount( this->_cfObject );
@@ -353,6 +467,8 @@ namespace CF
     {
         if( this->_cfObject != nullptr )
         {
+            this->Detach();
+            
             CFArrayRemoveAllValues( this->_cfObject );
         }
     }
@@ -374,6 +490,8 @@ namespace CF
             return;
         }
         
+        this->Detach();
+        
         CFArraySetValueAtIndex( this->_cfObject, index, value );
     }
     
@@ -384,6 +502,8 @@ namespace CF
             return;
         }
         
+        this->Detach();
+        
         CFArrayInsertValueAtIndex( this->_cfObject, index, value );
     }
     
@@ -394,6 +514,8 @@ namespace CF
             return;
         }
         
+        this->Detach();
+        
         CFArrayAppendValue( this->_cfObject, value );
     }
     
@@ -404,9 +526,39 @@ namespace CF
             return;
         }
         
+        this->Detach();
+        
         CFArrayRemoveValueAtIndex( this->_cfObject, index );
     }
     
+    void Array::AppendValues( const CFTypeRef * values, CFIndex count )
+    {
+        std::vector< CFTypeRef > nonNull;
+        
+        if( this->_cfObject == nullptr || values == nullptr || count <= 0 )
+        {
+            return;
+        }
+        
+        /* Null values are skipped, as with AppendValue */
+        if( std::find( values, values + count, nullptr ) != values + count )
+        {
+            std::copy_if( values, values + count, std::back_inserter( nonNull ), []( CFTypeRef value ) { return value != nullptr; } );
+            
+            values = nonNull.data();
+            count  = static_cast< CFIndex >( nonNull.size() );
+        }
+        
+        if( count == 0 )
+        {
+            return;
+        }
+        
+        this->Detach();
+        
+        CFArrayReplaceValues( this->_cfObject, CFRangeMake( CFArrayGetCount( this->_cfObject ), 0 ), const_cast< const void ** >( values ), count );
+    }
+    
     void Array::AppendArray( CFArrayRef array )
     {
         if( array == nullptr || CFGetTypeID( array ) != this->GetTypeID() )
@@ -416,12 +568,15 @@ namespace CF
         
         if( this->_cfObject != nullptr )
         {
+            CFRetain( array );
+            this->Detach();
             CFArrayAppendArray
             (
                 this->_cfObject,
                 array,
                 CFRangeMake( 0, CFArrayGetCount( array ) )
             );
+            CFRelease( array );
         }
     }
     
@@ -432,23 +587,137 @@ namespace CF
             return;
         }
         
+        this->Detach();
+        
         CFArrayExchangeValuesAtIndices( this->_cfObject, index1, index2 );
     }
     
+    void Array::Reserve( CFIndex capacity )
+    {
+        std::vector< CFTypeRef > values;
+        CFIndex                  count;
+        
+        if( this->_cfObject == nullptr || capacity <= this->GetCount() )
+        {
+            return;
+        }
+        
+        this->Detach();
+        
+        /*
+         * CFMutableArray has no capacity API, but growing it makes it
+         * reallocate its store, and removing the placeholders keeps it.
+         */
+        count = CFArrayGetCount( this->_cfObject );
+        
+        values.assign( static_cast< size_t >( capacity - count ), kCFNull );
+        CFArrayReplaceValues( this->_cfObject, CFRangeMake( count, 0 ), values.data(), capacity - count );
+        CFArrayReplaceValues( this->_cfObject, CFRangeMake( count, capacity - count ), nullptr, 0 );
+    }
+    
     Array::Iterator Array::begin() const
     {
-        return Iterator( this->_cfObject, this->GetCount() );
+        return Iterator( *( this ), 0, true );
     }
     
     Array::Iterator Array::end() const
     {
-        return Iterator( this->_cfObject, this->GetCount(), this->GetCount() );
+        return Iterator( *( this ), this->GetCount(), false );
+    }
+    
+    void Array::ForEach( const std::function< void( CFTypeRef ) > & function ) const
+    {
+        if( this->_cfObject == nullptr || !function )
+        {
+            return;
+        }
+        
+        CFArrayApplyFunction
+        (
+            this->_cfObject,
+            CFRangeMake( 0, CFArrayGetCount( this->_cfObject ) ),
+            __CFArrayApplierFunction,
+            const_cast< void * >( static_cast< const void * >( &function ) )
+        );
     }
         
     void swap( Array & v1, Array & v2 ) noexcept
     {
         using std::swap;
         
-        swap( v1._cfObject, v2._cfObject );
+        swap( v1._cfObject,    v2._cfObject );
+        swap( v1._mutable,     v2._mutable );
+        swap( v1._unshareable, v2._unshareable );
+        
+        v1._share = v2._share.exchange( v1._share.load() );
+    }
+    
+    void Array::Detach() const
+    {
+        CFMutableArrayRef array;
+        Share           * share;
+        
+        if( this->_cfObject == nullptr )
+        {
+            return;
+        }
+        
+        share = this->_share.load( std::memory_order_acquire );
+        
+        /*
+         * Acquire pairs with the release in ReleaseShare(), so reads made by
+         * copies that went away happen before we write in place.
+         */
+        if( this->_mutable && ( share == nullptr || share->count.load( std::memory_order_acquire ) == 1 ) )
+        {
+            return;
+        }
+        
+        array = CFArrayCreateMutableCopy( static_cast< CFAllocatorRef >( nullptr ), 0, this->_cfObject );
+        
+        if( array == nullptr )
+        {
+            return;
+        }
+        
+        CFRelease( this->_cfObject );
+        
+        this->ReleaseShare();
+        
+        this->_cfObject = array;
+        this->_mutable  = true;
+    }
+    
+    /*
+     * Iterators over wrappers may dereference to temporaries, so values are
+     * retained while the temporary is still alive, and released once the
+     * bulk append has retained them again.
+     */
+    CFTypeRef Array::RetainValue( CFTypeRef value )
+    {
+        return ( value == nullptr ) ? nullptr : CFRetain( value );
+    }
+    
+    void Array::ReleaseValues( const std::vector< CFTypeRef > & values )
+    {
+        for( CFTypeRef value: values )
+        {
+            if( value != nullptr )
+            {
+                CFRelease( value );
+            }
+        }
+    }
+    
+    void Array::ReleaseShare() const
+    {
+        Share * share;
+        
+        share = this->_share.exchange( nullptr );
+        
+        if( share != nullptr && share->count.fetch_sub( 1, std::memory_order_acq_rel ) == 1 )
+        {
+            delete share;
+        }
     }
 }
@@ -0,0 +1,210 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+/*!
+ * @file        CFPP-CRC32C.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    CoreFoundation++ incremental CRC-32C checksum
+ */
+
+#include <CF++.hpp>
+
+#if defined( __SSE4_2__ ) || defined( __AVX__ )
+#include <nmmintrin.h>
+#define CFPP_CRC32C_SSE42
+#elif defined( __ARM_FEATURE_CRC32 )
+#include <arm_acle.h>
+#define CFPP_CRC32C_ARM
+#endif
+
+#if !defined( CFPP_CRC32C_SSE42 ) && !defined( CFPP_CRC32C_ARM )
+
+struct __CRC32CTable
+{
+    __CRC32CTable()
+    {
+        UInt32 i;
+        UInt32 j;
+        UInt32 crc;
+        
+        for( i = 0; i < 256; i++ )
+        {
+            crc = i;
+            
+            for( j = 0; j < 8; j++ )
+            {
+                crc = ( crc >> 1 ) ^ ( 0x82F63B78 & ( 0 - ( crc & 1 ) ) );
+            }
+            
+            this->values[ 0 ][ i ] = crc;
+        }
+        
+        for( i = 0; i < 256; i++ )
+        {
+            for( j = 1; j < 8; j++ )
+            {
+                this->values[ j ][ i ] = ( this->values[ j - 1 ][ i ] >> 8 ) ^ this->values[ 0 ][ this->values[ j - 1 ][ i ] & 0xFF ];
+            }
+        }
+    }
+    
+    UInt32 values[ 8 ][ 256 ];
+};
+
+#endif
+
+static UInt32 __UpdateCRC32C( UInt32 crc, const UInt8 * bytes, size_t length );
+static UInt32 __UpdateCRC32C( UInt32 crc, const UInt8 * bytes, size_t length )
+{
+    #if defined( CFPP_CRC32C_SSE42 )
+    
+    #if defined( __x86_64__ ) || defined( _M_X64 )
+    
+    UInt64 w;
+    
+    for( ; length >= 8; length -= 8, bytes += 8 )
+    {
+        memcpy( &w, bytes, 8 );
+        
+        crc = static_cast< UInt32 >( _mm_crc32_u64( crc, w ) );
+    }
+    
+    #endif
+    
+    for( ; length > 0; length--, bytes++ )
+    {
+        crc = _mm_crc32_u8( crc, *( bytes ) );
+    }
+    
+    #elif defined( CFPP_CRC32C_ARM )
+    
+    UInt64 w;
+    
+    for( ; length >= 8; length -= 8, bytes += 8 )
+    {
+        memcpy( &w, bytes, 8 );
+        
+        crc = __crc32cd( crc, w );
+    }
+    
+    for( ; length > 0; length--, bytes++ )
+    {
+        crc = __crc32cb( crc, *( bytes ) );
+    }
+    
+    #else
+    
+    static const __CRC32CTable table;
+    
+    UInt32 lo;
+    UInt32 hi;
+    
+    /* Slicing-by-8 */
+    for( ; length >= 8; length -= 8, bytes += 8 )
+    {
+        memcpy( &lo, bytes,     4 );
+        memcpy( &hi, bytes + 4, 4 );
+        
+        lo  = CFSwapInt32LittleToHost( lo ) ^ crc;
+        hi  = CFSwapInt32LittleToHost( hi );
+        crc = table.values[ 7 ][ lo & 0xFF ] ^ table.values[ 6 ][ ( lo >> 8 ) & 0xFF ] ^ table.values[ 5 ][ ( lo >> 16 ) & 0xFF ] ^ table.values[ 4 ][ lo >> 24 ]
+            ^ table.values[ 3 ][ hi & 0xFF ] ^ table.values[ 2 ][ ( hi >> 8 ) & 0xFF ] ^ table.values[ 1 ][ ( hi >> 16 ) & 0xFF ] ^ table.values[ 0 ][ hi >> 24 ];
+    }
+    
+    for( ; length > 0; length--, bytes++ )
+    {
+        crc = ( crc >> 8 ) ^ table.values[ 0 ][ ( crc ^ *( bytes ) ) & 0xFF ];
+    }
+    
+    #endif
+    
+    return crc;
+}
+
+namespace CF
+{
+    CRC32C::CRC32C():
+        _crc( 0xFFFFFFFF )
+    {}
+    
+    CRC32C::CRC32C( const CRC32C & value ):
+        _crc( value._crc )
+    {}
+    
+    CRC32C::CRC32C( CRC32C && value ) noexcept:
+        _crc( value._crc )
+    {
+        value.Reset();
+    }
+    
+    CRC32C::~CRC32C()
+    {}
+    
+    CRC32C & CRC32C::operator =( CRC32C value )
+    {
+        swap( *( this ), value );
+        
+        return *( this );
+    }
+    
+    CRC32C & CRC32C::operator << ( const DataView & value )
+    {
+        this->Update( value );
+        
+        return *( this );
+    }
+    
+    void CRC32C::Update( const Data::Byte * bytes, CFIndex length )
+    {
+        if( bytes == nullptr || length <= 0 )
+        {
+            return;
+        }
+        
+        this->_crc = __UpdateCRC32C( this->_crc, bytes, static_cast< size_t >( length ) );
+    }
+    
+    void CRC32C::Update( const DataView & data )
+    {
+        this->Update( data.GetBytePtr(), data.GetLength() );
+    }
+    
+    UInt32 CRC32C::GetValue() const
+    {
+        return ~( this->_crc );
+    }
+    
+    void CRC32C::Reset()
+    {
+        this->_crc = 0xFFFFFFFF;
+    }
+    
+    void swap( CRC32C & v1, CRC32C & v2 ) noexcept
+    {
+        using std::swap;
+        
+        swap( v1._crc, v2._crc );
+    }
+}
@@ -0,0 +1,148 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+/*!
+ * @file        CFPP-Data-Appender.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Appender class for CF::Data
+ */
+
+#include <CF++.hpp>
+
+#define CFPP_DATA_APPENDER_CHUNK    256
+
+namespace CF
+{
+    Data::Appender::Appender( Data & data ): Appender( data, 0 )
+    {}
+    
+    Data::Appender::Appender( Data & data, CFIndex capacity ):
+        _data( data ),
+        _bp( nullptr ),
+        _base( data.GetLength() ),
+        _length( 0 ),
+        _capacity( 0 )
+    {
+        if( capacity > 0 )
+        {
+            this->Grow( capacity );
+        }
+    }
+    
+    Data::Appender::~Appender()
+    {
+        this->Commit();
+    }
+    
+    Data::Appender & Data::Appender::operator << ( Byte value )
+    {
+        if( this->_length == this->_capacity )
+        {
+            this->Grow( 1 );
+            
+            if( this->_length == this->_capacity )
+            {
+                return *( this );
+            }
+        }
+        
+        this->_bp[ this->_length++ ] = value;
+        
+        return *( this );
+    }
+    
+    Data::Appender & Data::Appender::operator << ( const DataView & value )
+    {
+        return this->Append( value.GetBytePtr(), value.GetLength() );
+    }
+    
+    Data::Appender & Data::Appender::Append( const Byte * bytes, CFIndex length )
+    {
+        if( bytes == nullptr || length <= 0 )
+        {
+            return *( this );
+        }
+        
+        if( this->_capacity - this->_length < length )
+        {
+            this->Grow( length );
+            
+            if( this->_capacity - this->_length < length )
+            {
+                return *( this );
+            }
+        }
+        
+        memcpy( this->_bp + this->_length, bytes, static_cast< size_t >( length ) );
+        
+        this->_length += length;
+        
+        return *( this );
+    }
+    
+    CFIndex Data::Appender::GetLength() const
+    {
+        return this->_length;
+    }
+    
+    void Data::Appender::Commit()
+    {
+        if( this->_data._cfObject != nullptr && this->_capacity > 0 )
+        {
+            CFDataSetLength( this->_data._cfObject, this->_base + this->_length );
+        }
+        
+        this->_base     += this->_length;
+        this->_bp        = nullptr;
+        this->_length    = 0;
+        this->_capacity  = 0;
+    }
+    
+    void Data::Appender::Grow( CFIndex length )
+    {
+        CFIndex capacity;
+        
+        if( this->_data._cfObject == nullptr )
+        {
+            return;
+        }
+        
+        /*
+         * The spare capacity is exposed as part of the data's length until the
+         * next commit, so it can be written through the byte pointer.
+         */
+        capacity = std::max( this->_capacity * 2, static_cast< CFIndex >( CFPP_DATA_APPENDER_CHUNK ) );
+        capacity = std::max( capacity, this->_length + length );
+        
+        this->_data.Detach();
+        
+        this->_data._unshareable = true;
+        
+        CFDataSetLength( this->_data._cfObject, this->_base + capacity );
+        
+        this->_bp       = CFDataGetMutableBytePtr( this->_data._cfObject ) + this->_base;
+        this->_capacity = capacity;
+    }
+}
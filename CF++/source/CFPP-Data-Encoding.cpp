@@ -0,0 +1,669 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+/*!
+ * @file        CFPP-Data-Encoding.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Base64 and hexadecimal codecs for CF::Data
+ */
+
+#include <CF++.hpp>
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+#include <emmintrin.h>
+#define CFPP_DATA_ENCODING_SSE2
+#endif
+
+#if defined( __SSSE3__ ) || defined( __AVX__ )
+#include <tmmintrin.h>
+#define CFPP_DATA_ENCODING_SSSE3
+#endif
+
+/*
+ * Stream chunk size, a multiple of both 3 and 4 so that whole base64 groups
+ * are encoded/decoded per chunk.
+ */
+#define CFPP_DATA_ENCODING_CHUNK    49152
+
+#define CFPP_DATA_ENCODING_INVALID  0xFF
+#define CFPP_DATA_ENCODING_PADDING  0xFE
+#define CFPP_DATA_ENCODING_SPACE    0xFD
+
+static const char __base64Alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+static const char __hexAlphabet[]    = "0123456789abcdef";
+
+struct __Base64DecodeTable
+{
+    __Base64DecodeTable()
+    {
+        size_t i;
+        
+        memset( this->values, CFPP_DATA_ENCODING_INVALID, sizeof( this->values ) );
+        
+        for( i = 0; i < 64; i++ )
+        {
+            this->values[ static_cast< UInt8 >( __base64Alphabet[ i ] ) ] = static_cast< UInt8 >( i );
+        }
+        
+        this->values[ static_cast< UInt8 >( '=' ) ]  = CFPP_DATA_ENCODING_PADDING;
+        this->values[ static_cast< UInt8 >( ' ' ) ]  = CFPP_DATA_ENCODING_SPACE;
+        this->values[ static_cast< UInt8 >( '\t' ) ] = CFPP_DATA_ENCODING_SPACE;
+        this->values[ static_cast< UInt8 >( '\r' ) ] = CFPP_DATA_ENCODING_SPACE;
+        this->values[ static_cast< UInt8 >( '\n' ) ] = CFPP_DATA_ENCODING_SPACE;
+    }
+    
+    UInt8 values[ 256 ];
+};
+
+#if defined( CFPP_DATA_ENCODING_SSSE3 )
+
+static void __EncodeBase64Block( const UInt8 * in, char * out );
+static void __EncodeBase64Block( const UInt8 * in, char * out )
+{
+    __m128i v;
+    __m128i t0;
+    __m128i t1;
+    __m128i r;
+    
+    /* Spreads 12 bytes into 16 sextets, then maps them to the alphabet */
+    v  = _mm_loadu_si128( reinterpret_cast< const __m128i * >( in ) );
+    v  = _mm_shuffle_epi8( v, _mm_set_epi8( 10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1 ) );
+    t0 = _mm_mulhi_epu16( _mm_and_si128( v, _mm_set1_epi32( 0x0FC0FC00 ) ), _mm_set1_epi32( 0x04000040 ) );
+    t1 = _mm_mullo_epi16( _mm_and_si128( v, _mm_set1_epi32( 0x003F03F0 ) ), _mm_set1_epi32( 0x01000010 ) );
+    v  = _mm_or_si128( t0, t1 );
+    r  = _mm_subs_epu8( v, _mm_set1_epi8( 51 ) );
+    r  = _mm_or_si128( r, _mm_and_si128( _mm_cmpgt_epi8( _mm_set1_epi8( 26 ), v ), _mm_set1_epi8( 13 ) ) );
+    r  = _mm_shuffle_epi8( _mm_setr_epi8( 'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0 ), r );
+    
+    _mm_storeu_si128( reinterpret_cast< __m128i * >( out ), _mm_add_epi8( r, v ) );
+}
+
+static bool __DecodeBase64Block( const char * in, UInt8 * out );
+static bool __DecodeBase64Block( const char * in, UInt8 * out )
+{
+    __m128i v;
+    __m128i hi;
+    __m128i lo;
+    __m128i roll;
+    
+    /* Validates and translates 16 characters, then packs them into 12 bytes */
+    v  = _mm_loadu_si128( reinterpret_cast< const __m128i * >( in ) );
+    hi = _mm_and_si128( _mm_srli_epi32( v, 4 ), _mm_set1_epi8( 0x0F ) );
+    lo = _mm_and_si128( v, _mm_set1_epi8( 0x0F ) );
+    lo = _mm_shuffle_epi8( _mm_setr_epi8( 0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A ), lo );
+    
+    if( _mm_movemask_epi8( _mm_cmpeq_epi8( _mm_and_si128( lo, _mm_shuffle_epi8( _mm_setr_epi8( 0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10 ), hi ) ), _mm_setzero_si128() ) ) != 0xFFFF )
+    {
+        return false;
+    }
+    
+    roll = _mm_add_epi8( _mm_cmpeq_epi8( v, _mm_set1_epi8( '/' ) ), hi );
+    v    = _mm_add_epi8( v, _mm_shuffle_epi8( _mm_setr_epi8( 0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0 ), roll ) );
+    v    = _mm_maddubs_epi16( v, _mm_set1_epi32( 0x01400140 ) );
+    v    = _mm_madd_epi16( v, _mm_set1_epi32( 0x00011000 ) );
+    v    = _mm_shuffle_epi8( v, _mm_setr_epi8( 2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1 ) );
+    
+    _mm_storeu_si128( reinterpret_cast< __m128i * >( out ), v );
+    
+    return true;
+}
+
+#endif
+
+#if defined( CFPP_DATA_ENCODING_SSE2 )
+
+static __m128i __HexDigits( __m128i nibbles );
+static __m128i __HexDigits( __m128i nibbles )
+{
+    return _mm_add_epi8( nibbles, _mm_add_epi8( _mm_set1_epi8( '0' ), _mm_and_si128( _mm_cmpgt_epi8( nibbles, _mm_set1_epi8( 9 ) ), _mm_set1_epi8( 'a' - '0' - 10 ) ) ) );
+}
+
+static bool __HexValues( __m128i chars, __m128i * values );
+static bool __HexValues( __m128i chars, __m128i * values )
+{
+    __m128i d;
+    __m128i l;
+    __m128i isDigit;
+    __m128i isAlpha;
+    
+    d       = _mm_sub_epi8( chars, _mm_set1_epi8( '0' ) );
+    l       = _mm_sub_epi8( _mm_or_si128( chars, _mm_set1_epi8( 0x20 ) ), _mm_set1_epi8( 'a' ) );
+    isDigit = _mm_and_si128( _mm_cmpgt_epi8( d, _mm_set1_epi8( -1 ) ), _mm_cmpgt_epi8( _mm_set1_epi8( 10 ), d ) );
+    isAlpha = _mm_and_si128( _mm_cmpgt_epi8( l, _mm_set1_epi8( -1 ) ), _mm_cmpgt_epi8( _mm_set1_epi8( 6 ), l ) );
+    
+    if( _mm_movemask_epi8( _mm_or_si128( isDigit, isAlpha ) ) != 0xFFFF )
+    {
+        return false;
+    }
+    
+    *( values ) = _mm_or_si128( _mm_and_si128( isDigit, d ), _mm_and_si128( isAlpha, _mm_add_epi8( l, _mm_set1_epi8( 10 ) ) ) );
+    *( values ) = _mm_or_si128( _mm_slli_epi16( _mm_and_si128( *( values ), _mm_set1_epi16( 0x00FF ) ), 4 ), _mm_srli_epi16( *( values ), 8 ) );
+    
+    return true;
+}
+
+#endif
+
+static size_t __EncodeBase64( const UInt8 * in, size_t length, char * out );
+static size_t __EncodeBase64( const UInt8 * in, size_t length, char * out )
+{
+    size_t i;
+    char * p;
+    UInt32 v;
+    
+    i = 0;
+    p = out;
+    
+    #if defined( CFPP_DATA_ENCODING_SSSE3 )
+    
+    for( ; i + 16 <= length; i += 12, p += 16 )
+    {
+        __EncodeBase64Block( in + i, p );
+    }
+    
+    #endif
+    
+    for( ; i + 3 <= length; i += 3, p += 4 )
+    {
+        v = ( static_cast< UInt32 >( in[ i ] ) << 16 ) | ( static_cast< UInt32 >( in[ i + 1 ] ) << 8 ) | in[ i + 2 ];
+        
+        p[ 0 ] = __base64Alphabet[ ( v >> 18 ) & 0x3F ];
+        p[ 1 ] = __base64Alphabet[ ( v >> 12 ) & 0x3F ];
+        p[ 2 ] = __base64Alphabet[ ( v >>  6 ) & 0x3F ];
+        p[ 3 ] = __base64Alphabet[ v & 0x3F ];
+    }
+    
+    if( i < length )
+    {
+        v = static_cast< UInt32 >( in[ i ] ) << 16;
+        
+        if( i + 1 < length )
+        {
+            v |= static_cast< UInt32 >( in[ i + 1 ] ) << 8;
+        }
+        
+        p[ 0 ] = __base64Alphabet[ ( v >> 18 ) & 0x3F ];
+        p[ 1 ] = __base64Alphabet[ ( v >> 12 ) & 0x3F ];
+        p[ 2 ] = ( i + 1 < length ) ? __base64Alphabet[ ( v >> 6 ) & 0x3F ] : '=';
+        p[ 3 ] = '=';
+        p     += 4;
+    }
+    
+    return static_cast< size_t >( p - out );
+}
+
+/*
+ * Decodes as many whole groups as possible. Whitespace is skipped and the
+ * trailing padding is optional. Unless final is set, an incomplete group is
+ * left unconsumed for the next call; `out` needs 16 bytes of slack past the
+ * decoded length.
+ */
+static bool __DecodeBase64( const char * in, size_t length, bool final, UInt8 * out, size_t * consumed, size_t * produced, bool * ended );
+static bool __DecodeBase64( const char * in, size_t length, bool final, UInt8 * out, size_t * consumed, size_t * produced, bool * ended )
+{
+    static const __Base64DecodeTable table;
+    
+    size_t  i;
+    size_t  j;
+    size_t  n;
+    size_t  start;
+    UInt8   q[ 4 ];
+    UInt8   v;
+    UInt8 * p;
+    
+    i = 0;
+    p = out;
+    
+    while( 1 )
+    {
+        #if defined( CFPP_DATA_ENCODING_SSSE3 )
+        
+        if( *( ended ) == false )
+        {
+            while( i + 16 <= length && __DecodeBase64Block( in + i, p ) )
+            {
+                i += 16;
+                p += 12;
+            }
+        }
+        
+        #endif
+        
+        while( *( ended ) == false && i + 4 <= length )
+        {
+            q[ 0 ] = table.values[ static_cast< UInt8 >( in[ i ] ) ];
+            q[ 1 ] = table.values[ static_cast< UInt8 >( in[ i + 1 ] ) ];
+            q[ 2 ] = table.values[ static_cast< UInt8 >( in[ i + 2 ] ) ];
+            q[ 3 ] = table.values[ static_cast< UInt8 >( in[ i + 3 ] ) ];
+            
+            /* Sextets are below 64; padding, whitespace and errors take the slow path */
+            if( ( q[ 0 ] | q[ 1 ] | q[ 2 ] | q[ 3 ] ) & 0xC0 )
+            {
+                break;
+            }
+            
+            p[ 0 ] = static_cast< UInt8 >( ( q[ 0 ] << 2 ) | ( q[ 1 ] >> 4 ) );
+            p[ 1 ] = static_cast< UInt8 >( ( q[ 1 ] << 4 ) | ( q[ 2 ] >> 2 ) );
+            p[ 2 ] = static_cast< UInt8 >( ( q[ 2 ] << 6 ) | q[ 3 ] );
+            p     += 3;
+            i     += 4;
+        }
+        
+        for( n = 0, j = i, start = length; j < length && n < 4; j++ )
+        {
+            v = table.values[ static_cast< UInt8 >( in[ j ] ) ];
+            
+            if( v == CFPP_DATA_ENCODING_SPACE )
+            {
+                continue;
+            }
+            
+            if( v == CFPP_DATA_ENCODING_INVALID || *( ended ) )
+            {
+                return false;
+            }
+            
+            start      = std::min( start, j );
+            q[ n++ ]   = v;
+        }
+        
+        if( n < 4 )
+        {
+            if( final == false || n == 0 )
+            {
+                i = ( n == 0 ) ? j : start;
+                
+                break;
+            }
+            
+            if( n == 1 )
+            {
+                return false;
+            }
+            
+            for( ; n < 4; n++ )
+            {
+                q[ n ] = CFPP_DATA_ENCODING_PADDING;
+            }
+        }
+        
+        if( q[ 0 ] == CFPP_DATA_ENCODING_PADDING || q[ 1 ] == CFPP_DATA_ENCODING_PADDING || ( q[ 2 ] == CFPP_DATA_ENCODING_PADDING && q[ 3 ] != CFPP_DATA_ENCODING_PADDING ) )
+        {
+            return false;
+        }
+        
+        *( p++ ) = static_cast< UInt8 >( ( q[ 0 ] << 2 ) | ( q[ 1 ] >> 4 ) );
+        
+        if( q[ 2 ] != CFPP_DATA_ENCODING_PADDING )
+        {
+            *( p++ ) = static_cast< UInt8 >( ( q[ 1 ] << 4 ) | ( q[ 2 ] >> 2 ) );
+        }
+        
+        if( q[ 3 ] != CFPP_DATA_ENCODING_PADDING )
+        {
+            *( p++ ) = static_cast< UInt8 >( ( q[ 2 ] << 6 ) | q[ 3 ] );
+        }
+        else
+        {
+            *( ended ) = true;
+        }
+        
+        i = j;
+    }
+    
+    *( consumed ) = i;
+    *( produced ) = static_cast< size_t >( p - out );
+    
+    return true;
+}
+
+static size_t __EncodeHex( const UInt8 * in, size_t length, char * out );
+static size_t __EncodeHex( const UInt8 * in, size_t length, char * out )
+{
+    size_t i;
+    
+    i = 0;
+    
+    #if defined( CFPP_DATA_ENCODING_SSE2 )
+    
+    for( ; i + 16 <= length; i += 16 )
+    {
+        __m128i v;
+        __m128i hi;
+        __m128i lo;
+        
+        v  = _mm_loadu_si128( reinterpret_cast< const __m128i * >( in + i ) );
+        hi = __HexDigits( _mm_and_si128( _mm_srli_epi16( v, 4 ), _mm_set1_epi8( 0x0F ) ) );
+        lo = __HexDigits( _mm_and_si128( v, _mm_set1_epi8( 0x0F ) ) );
+        
+        _mm_storeu_si128( reinterpret_cast< __m128i * >( out + ( i * 2 ) ),      _mm_unpacklo_epi8( hi, lo ) );
+        _mm_storeu_si128( reinterpret_cast< __m128i * >( out + ( i * 2 ) + 16 ), _mm_unpackhi_epi8( hi, lo ) );
+    }
+    
+    #endif
+    
+    for( ; i < length; i++ )
+    {
+        out[ i * 2 ]     = __hexAlphabet[ in[ i ] >> 4 ];
+        out[ i * 2 + 1 ] = __hexAlphabet[ in[ i ] & 0x0F ];
+    }
+    
+    return length * 2;
+}
+
+static int __HexValue( char c );
+static int __HexValue( char c )
+{
+    if( c >= '0' && c <= '9' )
+    {
+        return c - '0';
+    }
+    
+    c = static_cast< char >( c | 0x20 );
+    
+    if( c >= 'a' && c <= 'f' )
+    {
+        return c - 'a' + 10;
+    }
+    
+    return -1;
+}
+
+static bool __DecodeHex( const char * in, size_t length, UInt8 * out );
+static bool __DecodeHex( const char * in, size_t length, UInt8 * out )
+{
+    size_t i;
+    int    hi;
+    int    lo;
+    
+    i = 0;
+    
+    #if defined( CFPP_DATA_ENCODING_SSE2 )
+    
+    for( ; i + 32 <= length; i += 32 )
+    {
+        __m128i a;
+        __m128i b;
+        
+        if
+        (
+               __HexValues( _mm_loadu_si128( reinterpret_cast< const __m128i * >( in + i ) ),      &a ) == false
+            || __HexValues( _mm_loadu_si128( reinterpret_cast< const __m128i * >( in + i + 16 ) ), &b ) == false
+        )
+        {
+            return false;
+        }
+        
+        _mm_storeu_si128( reinterpret_cast< __m128i * >( out + ( i / 2 ) ), _mm_packus_epi16( a, b ) );
+    }
+    
+    #endif
+    
+    for( ; i + 2 <= length; i += 2 )
+    {
+        hi = __HexValue( in[ i ] );
+        lo = __HexValue( in[ i + 1 ] );
+        
+        if( hi < 0 || lo < 0 )
+        {
+            return false;
+        }
+        
+        out[ i / 2 ] = static_cast< UInt8 >( ( hi << 4 ) | lo );
+    }
+    
+    return i == length;
+}
+
+namespace CF
+{
+    Data Data::FromBase64( const std::string & value )
+    {
+        std::vector< Byte > bytes( ( value.length() / 4 ) * 3 + 16 );
+        size_t              consumed;
+        size_t              produced;
+        bool                ended;
+        
+        ended = false;
+        
+        if( __DecodeBase64( value.data(), value.length(), true, bytes.data(), &consumed, &produced, &ended ) == false )
+        {
+            return nullptr;
+        }
+        
+        bytes.resize( produced );
+        
+        return Data( std::move( bytes ) );
+    }
+    
+    Data Data::FromHex( const std::string & value )
+    {
+        std::vector< Byte > bytes( value.length() / 2 );
+        
+        if( __DecodeHex( value.data(), value.length(), bytes.data() ) == false )
+        {
+            return nullptr;
+        }
+        
+        return Data( std::move( bytes ) );
+    }
+    
+    bool Data::ToBase64( ReadStream & input, WriteStream & output )
+    {
+        std::vector< Byte > in( CFPP_DATA_ENCODING_CHUNK );
+        std::vector< char > out( ( CFPP_DATA_ENCODING_CHUNK / 3 ) * 4 );
+        size_t              pending;
+        size_t              n;
+        CFIndex             read;
+        
+        pending = 0;
+        
+        while( 1 )
+        {
+            read = input.Read( in.data() + pending, static_cast< CFIndex >( in.size() - pending ) );
+            
+            if( read < 0 )
+            {
+                return false;
+            }
+            
+            if( read == 0 )
+            {
+                break;
+            }
+            
+            pending += static_cast< size_t >( read );
+            n        = pending - ( pending % 3 );
+            
+            if( n > 0 )
+            {
+                if( output.WriteAll( reinterpret_cast< const Byte * >( out.data() ), static_cast< CFIndex >( __EncodeBase64( in.data(), n, out.data() ) ) ) == false )
+                {
+                    return false;
+                }
+                
+                memmove( in.data(), in.data() + n, pending - n );
+                
+                pending -= n;
+            }
+        }
+        
+        if( pending > 0 )
+        {
+            return output.WriteAll( reinterpret_cast< const Byte * >( out.data() ), static_cast< CFIndex >( __EncodeBase64( in.data(), pending, out.data() ) ) );
+        }
+        
+        return true;
+    }
+    
+    bool Data::FromBase64( ReadStream & input, WriteStream & output )
+    {
+        std::vector< char > in( CFPP_DATA_ENCODING_CHUNK );
+        std::vector< Byte > out;
+        size_t              pending;
+        size_t              consumed;
+        size_t              produced;
+        bool                ended;
+        CFIndex             read;
+        
+        pending = 0;
+        ended   = false;
+        
+        while( 1 )
+        {
+            /* Only whitespace between the characters of a group can pile up */
+            if( pending == in.size() )
+            {
+                in.resize( in.size() * 2 );
+            }
+            
+            read = input.Read( reinterpret_cast< Byte * >( in.data() + pending ), static_cast< CFIndex >( in.size() - pending ) );
+            
+            if( read < 0 )
+            {
+                return false;
+            }
+            
+            pending += static_cast< size_t >( read );
+            
+            out.resize( ( pending / 4 ) * 3 + 16 );
+            
+            if( __DecodeBase64( in.data(), pending, read == 0, out.data(), &consumed, &produced, &ended ) == false )
+            {
+                return false;
+            }
+            
+            if( produced > 0 && output.WriteAll( out.data(), static_cast< CFIndex >( produced ) ) == false )
+            {
+                return false;
+            }
+            
+            memmove( in.data(), in.data() + consumed, pending - consumed );
+            
+            pending -= consumed;
+            
+            if( read == 0 )
+            {
+                return true;
+            }
+        }
+    }
+    
+    bool Data::ToHex( ReadStream & input, WriteStream & output )
+    {
+        std::vector< Byte > in( CFPP_DATA_ENCODING_CHUNK );
+        std::vector< char > out( CFPP_DATA_ENCODING_CHUNK * 2 );
+        CFIndex             read;
+        
+        while( 1 )
+        {
+            read = input.Read( in.data(), static_cast< CFIndex >( in.size() ) );
+            
+            if( read < 0 )
+            {
+                return false;
+            }
+            
+            if( read == 0 )
+            {
+                return true;
+            }
+            
+            if( output.WriteAll( reinterpret_cast< const Byte * >( out.data() ), static_cast< CFIndex >( __EncodeHex( in.data(), static_cast< size_t >( read ), out.data() ) ) ) == false )
+            {
+                return false;
+            }
+        }
+    }
+    
+    bool Data::FromHex( ReadStream & input, WriteStream & output )
+    {
+        std::vector< char > in( CFPP_DATA_ENCODING_CHUNK );
+        std::vector< Byte > out( CFPP_DATA_ENCODING_CHUNK / 2 );
+        size_t              pending;
+        size_t              n;
+        CFIndex             read;
+        
+        pending = 0;
+        
+        while( 1 )
+        {
+            read = input.Read( reinterpret_cast< Byte * >( in.data() + pending ), static_cast< CFIndex >( in.size() - pending ) );
+            
+            if( read < 0 )
+            {
+                return false;
+            }
+            
+            if( read == 0 )
+            {
+                return pending == 0;
+            }
+            
+            pending += static_cast< size_t >( read );
+            n        = pending & ~static_cast< size_t >( 1 );
+            
+            if( n > 0 )
+            {
+                if( __DecodeHex( in.data(), n, out.data() ) == false || output.WriteAll( out.data(), static_cast< CFIndex >( n / 2 ) ) == false )
+                {
+                    return false;
+                }
+                
+                memmove( in.data(), in.data() + n, pending - n );
+                
+                pending -= n;
+            }
+        }
+    }
+    
+    std::string Data::ToBase64() const
+    {
+        std::string s;
+        
+        s.resize( ( ( static_cast< size_t >( this->GetLength() ) + 2 ) / 3 ) * 4 );
+        
+        if( s.empty() == false )
+        {
+            __EncodeBase64( this->GetBytePtr(), static_cast< size_t >( this->GetLength() ), &( s[ 0 ] ) );
+        }
+        
+        return s;
+    }
+    
+    std::string Data::ToHex() const
+    {
+        std::string s;
+        
+        s.resize( static_cast< size_t >( this->GetLength() ) * 2 );
+        
+        if( s.empty() == false )
+        {
+            __EncodeHex( this->GetBytePtr(), static_cast< size_t >( this->GetLength() ), &( s[ 0 ] ) );
+        }
+        
+        return s;
+    }
+}
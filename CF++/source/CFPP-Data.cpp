@@ -29,9 +29,109 @@
  */
 
 #include <CF++.hpp>
+#include <limits>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+static const void * __DeallocatorRetain( const void * info );
+static const void * __DeallocatorRetain( const void * info )
+{
+    return info;
+}
+
+static void __DeallocatorRelease( const void * info );
+static void __DeallocatorRelease( const void * info )
+{
+    delete static_cast< const std::function< void( const void * ) > * >( info );
+}
+
+static void * __DeallocatorAllocate( CFIndex size, CFOptionFlags hint, void * info );
+static void * __DeallocatorAllocate( CFIndex size, CFOptionFlags hint, void * info )
+{
+    ( void )size;
+    ( void )hint;
+    ( void )info;
+    
+    return nullptr;
+}
+
+static void __DeallocatorDeallocate( void * ptr, void * info );
+static void __DeallocatorDeallocate( void * ptr, void * info )
+{
+    const std::function< void( const void * ) > * f;
+    
+    f = static_cast< const std::function< void( const void * ) > * >( info );
+    
+    if( *( f ) != nullptr )
+    {
+        ( *( f ) )( ptr );
+    }
+}
+
+static void __Prefault( const volatile UInt8 * bytes, size_t length, size_t pageSize );
+static void __Prefault( const volatile UInt8 * bytes, size_t length, size_t pageSize )
+{
+    size_t i;
+    
+    for( i = 0; i < length; i += pageSize )
+    {
+        ( void )bytes[ i ];
+    }
+}
+
+static CFDataRef __CreateDataNoCopy( const UInt8 * bytes, CFIndex length, const std::function< void( const void * ) > & deallocator );
+static CFDataRef __CreateDataNoCopy( const UInt8 * bytes, CFIndex length, const std::function< void( const void * ) > & deallocator )
+{
+    CFAllocatorContext context;
+    CFAllocatorRef     allocator;
+    CFDataRef          data;
+    
+    memset( &context, 0, sizeof( CFAllocatorContext ) );
+    
+    context.info       = new std::function< void( const void * ) >( deallocator );
+    context.retain     = &__DeallocatorRetain;
+    context.release    = &__DeallocatorRelease;
+    context.allocate   = &__DeallocatorAllocate;
+    context.deallocate = &__DeallocatorDeallocate;
+    allocator          = CFAllocatorCreate( static_cast< CFAllocatorRef >( nullptr ), &context );
+    
+    if( allocator == nullptr )
+    {
+        __DeallocatorDeallocate( const_cast< UInt8 * >( bytes ), context.info );
+        __DeallocatorRelease( context.info );
+        
+        return nullptr;
+    }
+    
+    data = CFDataCreateWithBytesNoCopy( static_cast< CFAllocatorRef >( nullptr ), bytes, length, allocator );
+    
+    if( data == nullptr )
+    {
+        __DeallocatorDeallocate( const_cast< UInt8 * >( bytes ), context.info );
+    }
+    
+    CFRelease( allocator );
+    
+    return data;
+}
 
 namespace CF
 {
+    struct Data::Share
+    {
+        Share( CFIndex value ): count( value )
+        {}
+        
+        std::atomic< CFIndex > count;
+    };
+    
     Data Data::Referencing( CFMutableDataRef cfObject )
     {
         if( cfObject == nullptr )
@@ -41,38 +141,279 @@ namespace CF
         
         CF::Data data( nullptr );
         
-        data._cfObject = static_cast< CFMutableDataRef >( const_cast< void * >( CFRetain( cfObject ) ) );
+        data._cfObject    = static_cast< CFMutableDataRef >( const_cast< void * >( CFRetain( cfObject ) ) );
+        data._unshareable = true;
         
         return data;
     }
     
-    Data::Data(): _cfObject( nullptr )
+    Data Data::NoCopy( const Byte * bytes, CFIndex length, CFAllocatorRef deallocator )
+    {
+        if( bytes == nullptr )
+        {
+            return nullptr;
+        }
+        
+        return Adopting( CFDataCreateWithBytesNoCopy( static_cast< CFAllocatorRef >( nullptr ), bytes, length, deallocator ) );
+    }
+    
+    Data Data::NoCopy( const Byte * bytes, CFIndex length, const std::function< void( const Byte * ) > & deallocator )
+    {
+        if( bytes == nullptr )
+        {
+            return nullptr;
+        }
+        
+        return Adopting
+        (
+            __CreateDataNoCopy
+            (
+                bytes,
+                length,
+                [ = ]( const void * p )
+                {
+                    if( deallocator != nullptr )
+                    {
+                        deallocator( static_cast< const Byte * >( p ) );
+                    }
+                }
+            )
+        );
+    }
+    
+    Data Data::MapFile( const std::string & path, CFOptionFlags options )
+    {
+        #ifdef _WIN32
+        
+        HANDLE        file;
+        HANDLE        mapping;
+        LARGE_INTEGER size;
+        SYSTEM_INFO   info;
+        void        * bytes;
+        DWORD         flags;
+        
+        flags = FILE_ATTRIBUTE_NORMAL;
+        
+        if( options & MapOptionSequential )
+        {
+            flags |= FILE_FLAG_SEQUENTIAL_SCAN;
+        }
+        else if( options & MapOptionRandom )
+        {
+            flags |= FILE_FLAG_RANDOM_ACCESS;
+        }
+        
+        file = CreateFileA( path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, flags, nullptr );
+        
+        if( file == INVALID_HANDLE_VALUE )
+        {
+            return nullptr;
+        }
+        
+        if( GetFileSizeEx( file, &size ) == FALSE || static_cast< unsigned long long >( size.QuadPart ) > static_cast< unsigned long long >( std::numeric_limits< CFIndex >::max() ) )
+        {
+            CloseHandle( file );
+            
+            return nullptr;
+        }
+        
+        if( size.QuadPart == 0 )
+        {
+            CloseHandle( file );
+            
+            return Data();
+        }
+        
+        mapping = CreateFileMappingA( file, nullptr, PAGE_READONLY, 0, 0, nullptr );
+        
+        CloseHandle( file );
+        
+        if( mapping == nullptr )
+        {
+            return nullptr;
+        }
+        
+        bytes = MapViewOfFile( mapping, FILE_MAP_READ, 0, 0, 0 );
+        
+        CloseHandle( mapping );
+        
+        if( bytes == nullptr )
+        {
+            return nullptr;
+        }
+        
+        GetSystemInfo( &info );
+        
+        if( options & ( MapOptionWillNeed | MapOptionPrefault ) )
+        {
+            __Prefault( static_cast< const UInt8 * >( bytes ), static_cast< size_t >( size.QuadPart ), info.dwPageSize );
+        }
+        
+        return NoCopy( static_cast< const Byte * >( bytes ), static_cast< CFIndex >( size.QuadPart ), [ = ]( const Byte * p ) { UnmapViewOfFile( p ); } );
+        
+        #else
+        
+        int         fd;
+        struct stat st;
+        void      * bytes;
+        size_t      length;
+        int         flags;
+        
+        fd = open( path.c_str(), O_RDONLY | O_CLOEXEC );
+        
+        if( fd < 0 )
+        {
+            return nullptr;
+        }
+        
+        if( fstat( fd, &st ) != 0 || S_ISREG( st.st_mode ) == false || static_cast< unsigned long long >( st.st_size ) > static_cast< unsigned long long >( std::numeric_limits< CFIndex >::max() ) )
+        {
+            close( fd );
+            
+            return nullptr;
+        }
+        
+        if( st.st_size == 0 )
+        {
+            close( fd );
+            
+            return Data();
+        }
+        
+        length = static_cast< size_t >( st.st_size );
+        flags  = MAP_PRIVATE;
+        
+        #ifdef MAP_POPULATE
+        if( options & MapOptionPrefault )
+        {
+            flags |= MAP_POPULATE;
+        }
+        #endif
+        
+        bytes = mmap( nullptr, length, PROT_READ, flags, fd, 0 );
+        
+        close( fd );
+        
+        if( bytes == MAP_FAILED )
+        {
+            return nullptr;
+        }
+        
+        if( options & MapOptionSequential )
+        {
+            posix_madvise( bytes, length, POSIX_MADV_SEQUENTIAL );
+        }
+        else if( options & MapOptionRandom )
+        {
+            posix_madvise( bytes, length, POSIX_MADV_RANDOM );
+        }
+        
+        if( options & MapOptionWillNeed )
+        {
+            posix_madvise( bytes, length, POSIX_MADV_WILLNEED );
+        }
+        
+        #ifndef MAP_POPULATE
+        if( options & MapOptionPrefault )
+        {
+            __Prefault( static_cast< const UInt8 * >( bytes ), length, static_cast< size_t >( sysconf( _SC_PAGESIZE ) ) );
+        }
+        #endif
+        
+        return NoCopy( static_cast< const Byte * >( bytes ), static_cast< CFIndex >( length ), [ = ]( const Byte * p ) { munmap( const_cast< Byte * >( p ), length ); } );
+        
+        #endif
+    }
+    
+    Data::Data():
+        _cfObject( nullptr ),
+        _share( nullptr ),
+        _mutable( true ),
+        _unshareable( false )
     {
         this->_cfObject = CFDataCreateMutable( static_cast< CFAllocatorRef >( nullptr ), 0 );
     }
     
-    Data::Data( CFIndex capacity ): _cfObject( nullptr )
+    Data::Data( CFIndex capacity ):
+        _cfObject( nullptr ),
+        _share( nullptr ),
+        _mutable( true ),
+        _unshareable( false )
     {
-        this->_cfObject = CFDataCreateMutable( static_cast< CFAllocatorRef >( nullptr ), capacity );
+        this->_cfObject = CFDataCreateMutable( static_cast< CFAllocatorRef >( nullptr ), 0 );
+        
+        this->Reserve( capacity );
     }
     
-    Data::Data( const Data & value ): _cfObject( nullptr )
+    Data::Data( const Data & value ):
+        _cfObject( nullptr ),
+        _share( nullptr ),
+        _mutable( true ),
+        _unshareable( false )
     {
-        if( value._cfObject != nullptr )
+        Share * share;
+        Share * expected;
+        
+        if( value._cfObject == nullptr )
+        {
+            return;
+        }
+        
+        /*
+         * Bytes reachable through an escaped mutable pointer, an Appender or
+         * a referenced CFMutableData may change under us, so they're copied.
+         */
+        if( value._unshareable )
         {
             this->_cfObject = CFDataCreateMutableCopy( static_cast< CFAllocatorRef >( nullptr ), 0, value._cfObject );
+            
+            return;
         }
+        
+        /*
+         * The share count is created by the first copy, and published with a
+         * CAS since the source may be copied from several threads at once.
+         * The source holds the initial reference.
+         */
+        share = value._share.load( std::memory_order_acquire );
+        
+        if( share == nullptr )
+        {
+            share    = new Share( 1 );
+            expected = nullptr;
+            
+            if( value._share.compare_exchange_strong( expected, share, std::memory_order_acq_rel ) == false )
+            {
+                delete share;
+                
+                share = expected;
+            }
+        }
+        
+        share->count.fetch_add( 1, std::memory_order_relaxed );
+        
+        this->_cfObject = static_cast< CFMutableDataRef >( const_cast< void * >( CFRetain( value._cfObject ) ) );
+        this->_share    = share;
+        this->_mutable  = value._mutable;
     }
     
-    Data::Data( const AutoPointer & value ): _cfObject( nullptr )
+    Data::Data( const AutoPointer & value ):
+        _cfObject( nullptr ),
+        _share( nullptr ),
+        _mutable( true ),
+        _unshareable( false )
     {
         if( value.IsValid() && value.GetTypeID() == this->GetTypeID() )
         {
-            this->_cfObject = CFDataCreateMutableCopy( static_cast< CFAllocatorRef >( nullptr ), 0, static_cast< CFDataRef >( value ) );
+            this->_cfObject = CFDataCreateMutableCopy( static_cast< CFAllocatorRef >( nullptr ), 0, static_cast< CFDataRef >( value.GetCFObject() ) );
         }
     }
     
-    Data::Data( CFTypeRef value ): _cfObject( nullptr )
+    Data::Data( CFTypeRef value ):
+        _cfObject( nullptr ),
+        _share( nullptr ),
+        _mutable( true ),
+        _unshareable( false )
     {
         if( value != nullptr && CFGetTypeID( value ) == this->GetTypeID() )
         {
@@ -80,7 +421,11 @@ namespace CF
         }
     }
     
-    Data::Data( CFDataRef value ): _cfObject( nullptr )
+    Data::Data( CFDataRef value ):
+        _cfObject( nullptr ),
+        _share( nullptr ),
+        _mutable( true ),
+        _unshareable( false )
     {
         if( value != nullptr && CFGetTypeID( value ) == this->GetTypeID() )
         {
@@ -88,7 +433,11 @@ namespace CF
         }
     }
     
-    Data::Data( CFStringRef value ): _cfObject( nullptr )
+    Data::Data( CFStringRef value ):
+        _cfObject( nullptr ),
+        _share( nullptr ),
+        _mutable( true ),
+        _unshareable( false )
     {
         if( value != nullptr && CFGetTypeID( value ) == CFStringGetTypeID() )
         {
@@ -101,14 +450,22 @@ namespace CF
     Data::Data( std::nullptr_t ): Data( static_cast< CFTypeRef >( nullptr ) )
     {}
     
-    Data::Data( const std::string & value ): _cfObject( nullptr )
+    Data::Data( const std::string & value ):
+        _cfObject( nullptr ),
+        _share( nullptr ),
+        _mutable( true ),
+        _unshareable( false )
     {
         this->_cfObject = CFDataCreateMutable( static_cast< CFAllocatorRef >( nullptr ), 0 );
         
         CFDataAppendBytes( this->_cfObject, reinterpret_cast< const UInt8 * >( value.c_str() ), static_cast< CFIndex >( value.length() ) );
     }
     
-    Data::Data( const Byte * value, CFIndex length ): _cfObject( nullptr )
+    Data::Data( const Byte * value, CFIndex length ):
+        _cfObject( nullptr ),
+        _share( nullptr ),
+        _mutable( true ),
+        _unshareable( false )
     {
         if( value != nullptr )
         {
@@ -120,28 +477,71 @@ namespace CF
     
     Data::Data( std::initializer_list< Byte > value ): Data()
     {
-        for( Byte b: value )
+        CFDataAppendBytes( this->_cfObject, value.begin(), static_cast< CFIndex >( value.size() ) );
+    }
+    
+    Data::Data( const std::vector< Byte > & value ): Data()
+    {
+        CFDataAppendBytes( this->_cfObject, value.data(), static_cast< CFIndex >( value.size() ) );
+    }
+    
+    Data::Data( std::string && value ):
+        _cfObject( nullptr ),
+        _share( nullptr ),
+        _mutable( true ),
+        _unshareable( false )
+    {
+        std::string * str;
+        
+        if( value.empty() )
         {
-            CFDataAppendBytes( this->_cfObject, &b, 1 );
+            this->_cfObject = CFDataCreateMutable( static_cast< CFAllocatorRef >( nullptr ), 0 );
+            
+            return;
         }
+        
+        str = new std::string( std::move( value ) );
+        
+        this->_cfObject = static_cast< CFMutableDataRef >( const_cast< void * >( static_cast< const void * >( __CreateDataNoCopy( reinterpret_cast< const UInt8 * >( str->data() ), static_cast< CFIndex >( str->length() ), [ = ]( const void * ) { delete str; } ) ) ) );
+        this->_mutable  = false;
     }
     
-    Data::Data( const std::vector< Byte > & value ): Data()
+    Data::Data( std::vector< Byte > && value ):
+        _cfObject( nullptr ),
+        _share( nullptr ),
+        _mutable( true ),
+        _unshareable( false )
     {
-        for( Byte b: value )
+        std::vector< Byte > * vec;
+        
+        if( value.empty() )
         {
-            CFDataAppendBytes( this->_cfObject, &b, 1 );
+            this->_cfObject = CFDataCreateMutable( static_cast< CFAllocatorRef >( nullptr ), 0 );
+            
+            return;
         }
+        
+        vec = new std::vector< Byte >( std::move( value ) );
+        
+        this->_cfObject = static_cast< CFMutableDataRef >( const_cast< void * >( static_cast< const void * >( __CreateDataNoCopy( vec->data(), static_cast< CFIndex >( vec->size() ), [ = ]( const void * ) { delete vec; } ) ) ) );
+        this->_mutable  = false;
     }
     
-    Data::Data( Data && value ) noexcept
+    Data::Data( Data && value ) noexcept:
+        _cfObject( value._cfObject ),
+        _share( value._share.exchange( nullptr ) ),
+        _mutable( value._mutable ),
+        _unshareable( value._unshareable )
     {
-        this->_cfObject = value._cfObject;
-        value._cfObject = nullptr;
+        value._cfObject    = nullptr;
+        value._mutable     = true;
+        value._unshareable = false;
     }
     
     Data::~Data()
     {
+        this->ReleaseShare();
+        
         if( this->_cfObject != nullptr )
         {
             CFRelease( this->_cfObject );
@@ -232,6 +632,8 @@ namespace CF
             
     Data & Data::operator += ( Byte value )
     {
+        this->Detach();
+        
         if( this->_cfObject != nullptr )
         {
             CFDataAppendBytes( this->_cfObject, &value, 1 );
@@ -242,6 +644,8 @@ namespace CF
     
     Data & Data::operator += ( CFStringRef value )
     {
+        this->Detach();
+        
         if( this->_cfObject != nullptr && value != nullptr && CFGetTypeID( value ) == CFStringGetTypeID() )
         {
             CFDataAppendBytes( this->_cfObject, reinterpret_cast< const UInt8 * >( CFStringGetCStringPtr( value, kCFStringEncodingUTF8 ) ), CFStringGetLength( value ) );
@@ -254,7 +658,10 @@ namespace CF
     {
         if( this->_cfObject != nullptr && value != nullptr && CFGetTypeID( value ) == this->GetTypeID() )
         {
+            CFRetain( value );
+            this->Detach();
             CFDataAppendBytes( this->_cfObject, CFDataGetBytePtr( value ), CFDataGetLength( value ) );
+            CFRelease( value );
         }
         
         return *( this );
@@ -262,11 +669,13 @@ namespace CF
     
     Data & Data::operator += ( const Data & value )
     {
-        return operator += ( value._cfObject );
+        return operator += ( static_cast< CFDataRef >( value._cfObject ) );
     }
     
     Data & Data::operator += ( const std::string & value )
     {
+        this->Detach();
+        
         if( this->_cfObject != nullptr )
         {
             CFDataAppendBytes( this->_cfObject, reinterpret_cast< const UInt8 * >( value.c_str() ), static_cast< CFIndex >( value.length() ) );
@@ -277,6 +686,8 @@ namespace CF
     
     Data & Data::operator += ( const std::vector< Byte > & value )
     {
+        this->Detach();
+        
         if( this->_cfObject != nullptr )
         {
             CFDataAppendBytes( this->_cfObject, value.data(), static_cast< CFIndex >( value.size() ) );
@@ -285,6 +696,13 @@ namespace CF
         return *( this );
     }
     
+    Data & Data::operator += ( const DataView & value )
+    {
+        this->AppendBytes( value );
+        
+        return *( this );
+    }
+    
     CFTypeID Data::GetTypeID() const
     {
         return CFDataGetTypeID();
@@ -295,6 +713,24 @@ namespace CF
         return this->_cfObject;
     }
     
+    Data::operator CFMutableDataRef () const
+    {
+        if( this->_cfObject == nullptr )
+        {
+            return nullptr;
+        }
+        
+        /*
+         * Same as GetMutableBytePtr(): the caller may write to the object
+         * directly, so it's detached from any copy and never shared again.
+         */
+        this->Detach();
+        
+        this->_unshareable = true;
+        
+        return this->_cfObject;
+    }
+    
     CFIndex Data::GetLength() const
     {
         if( this->_cfObject == nullptr )
@@ -312,6 +748,8 @@ namespace CF
             return;
         }
         
+        this->Detach();
+        
         CFDataSetLength( this->_cfObject, length );
     }
     
@@ -322,6 +760,8 @@ namespace CF
             return;
         }
         
+        this->Detach();
+        
         CFDataIncreaseLength( this->_cfObject, extraLength );
     }
     
@@ -335,13 +775,21 @@ namespace CF
         return CFDataGetBytePtr( this->_cfObject );
     }
     
-    Byte * Data::GetMutableBytePtr() const
+    Byte * Data::GetMutableBytePtr()
     {
         if( this->_cfObject == nullptr )
         {
             return nullptr;
         }
         
+        this->Detach();
+        
+        /*
+         * Writes through the returned pointer can't be tracked, so this
+         * buffer is never shared again.
+         */
+        this->_unshareable = true;
+        
         return CFDataGetMutableBytePtr( this->_cfObject );
     }
     
@@ -362,9 +810,37 @@ namespace CF
             return;
         }
         
+        this->Detach();
+        
         CFDataAppendBytes( this->_cfObject, bytes, length );
     }
     
+    void Data::AppendBytes( const DataView & bytes )
+    {
+        const Byte * bp;
+        
+        if( this->_cfObject == nullptr || bytes.IsEmpty() )
+        {
+            return;
+        }
+        
+        this->Detach();
+        
+        bp = CFDataGetBytePtr( this->_cfObject );
+        
+        /* Appending may reallocate our own storage, which a view may point into */
+        if( bytes.GetBytePtr() >= bp && bytes.GetBytePtr() < bp + CFDataGetLength( this->_cfObject ) )
+        {
+            std::vector< Byte > copy( bytes.begin(), bytes.end() );
+            
+            CFDataAppendBytes( this->_cfObject, copy.data(), static_cast< CFIndex >( copy.size() ) );
+        }
+        else
+        {
+            CFDataAppendBytes( this->_cfObject, bytes.GetBytePtr(), bytes.GetLength() );
+        }
+    }
+    
     void Data::ReplaceBytes( CFRange range, const Byte * newBytes, CFIndex newLength )
     {
         if( this->_cfObject == nullptr || newBytes == nullptr )
@@ -372,6 +848,8 @@ namespace CF
             return;
         }
         
+        this->Detach();
+        
         CFDataReplaceBytes( this->_cfObject, range, newBytes, newLength );
     }
     
@@ -382,6 +860,8 @@ namespace CF
             return;
         }
         
+        this->Detach();
+        
         CFDataDeleteBytes( this->_cfObject, range );
     }
     
@@ -397,7 +877,39 @@ namespace CF
             return r;
         }
         
-        return CFDataFind( this->_cfObject, data, range, flags );
+        return DataView( *( this ) ).Find( data, range, flags );
+    }
+    
+    CFRange Data::FindAny( const std::vector< DataView > & data, CFRange range, CFIndex * index ) const
+    {
+        return DataView( *( this ) ).FindAny( data, range, index );
+    }
+    
+    UInt32 Data::GetCRC32C() const
+    {
+        CRC32C crc;
+        
+        crc.Update( *( this ) );
+        
+        return crc.GetValue();
+    }
+    
+    UInt64 Data::GetXXHash64( UInt64 seed ) const
+    {
+        XXHash64 hash( seed );
+        
+        hash.Update( *( this ) );
+        
+        return hash.GetValue();
+    }
+    
+    Data Data::GetSHA256() const
+    {
+        SHA256 hash;
+        
+        hash.Update( *( this ) );
+        
+        return hash.GetValue();
     }
     
     Data::Iterator Data::begin() const
@@ -410,10 +922,146 @@ namespace CF
         return Iterator( this->_cfObject, this->GetLength(), this->GetLength() );
     }
     
+    void Data::Reserve( CFIndex capacity )
+    {
+        CFIndex length;
+        
+        if( this->_cfObject == nullptr || capacity <= this->GetLength() )
+        {
+            return;
+        }
+        
+        this->Detach();
+        
+        /*
+         * CFMutableData has no capacity API, but growing the length makes it
+         * reallocate, and shrinking it back keeps the allocation.
+         */
+        length = CFDataGetLength( this->_cfObject );
+        
+        CFDataSetLength( this->_cfObject, capacity );
+        CFDataSetLength( this->_cfObject, length );
+    }
+    
+    void Data::ShrinkToFit()
+    {
+        CFMutableDataRef data;
+        
+        if( this->_cfObject == nullptr )
+        {
+            return;
+        }
+        
+        this->Detach();
+        
+        /* Referenced objects and escaped pointers must keep the same buffer */
+        if( this->_unshareable )
+        {
+            return;
+        }
+        
+        data = CFDataCreateMutableCopy( static_cast< CFAllocatorRef >( nullptr ), 0, this->_cfObject );
+        
+        if( data == nullptr )
+        {
+            return;
+        }
+        
+        CFRelease( this->_cfObject );
+        
+        this->_cfObject = data;
+    }
+    
+    const Byte * Data::cbegin() const
+    {
+        return this->GetBytePtr();
+    }
+    
+    const Byte * Data::cend() const
+    {
+        return this->GetBytePtr() + this->GetLength();
+    }
+    
+    Byte * Data::MutableBegin()
+    {
+        return this->GetMutableBytePtr();
+    }
+    
+    Byte * Data::MutableEnd()
+    {
+        return this->GetMutableBytePtr() + this->GetLength();
+    }
+    
     void swap( Data & v1, Data & v2 ) noexcept
     {
         using std::swap;
         
-        swap( v1._cfObject, v2._cfObject );
+        swap( v1._cfObject,    v2._cfObject );
+        swap( v1._mutable,     v2._mutable );
+        swap( v1._unshareable, v2._unshareable );
+        
+        v1._share = v2._share.exchange( v1._share.load() );
+    }
+    
+    Data Data::Adopting( CFDataRef cfObject )
+    {
+        Data data( nullptr );
+        
+        /*
+         * No-copy data is immutable, so it's treated as shared and copied
+         * on the first mutation.
+         */
+        data._cfObject = static_cast< CFMutableDataRef >( const_cast< void * >( static_cast< const void * >( cfObject ) ) );
+        data._mutable  = false;
+        
+        return data;
+    }
+    
+    void Data::Detach() const
+    {
+        CFMutableDataRef data;
+        Share          * share;
+        
+        if( this->_cfObject == nullptr )
+        {
+            return;
+        }
+        
+        share = this->_share.load( std::memory_order_acquire );
+        
+        /*
+         * Acquire pairs with the release in ReleaseShare(), so reads made by
+         * copies that went away happen before we write in place.
+         */
+        if( this->_mutable && ( share == nullptr || share->count.load( std::memory_order_acquire ) == 1 ) )
+        {
+            return;
+        }
+        
+        data = CFDataCreateMutableCopy( static_cast< CFAllocatorRef >( nullptr ), 0, this->_cfObject );
+        
+        if( data == nullptr )
+        {
+            return;
+        }
+        
+        CFRelease( this->_cfObject );
+        
+        this->ReleaseShare();
+        
+        this->_cfObject = data;
+        this->_mutable  = true;
+    }
+    
+    void Data::ReleaseShare() const
+    {
+        Share * share;
+        
+        share = this->_share.exchange( nullptr );
+        
+        if( share != nullptr && share->count.fetch_sub( 1, std::memory_order_acq_rel ) == 1 )
+        {
+            delete share;
+        }
     }
 }
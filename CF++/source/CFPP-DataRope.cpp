@@ -0,0 +1,575 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+/*!
+ * @file        CFPP-DataRope.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    CoreFoundation++ chunked byte buffer with logarithmic edits
+ */
+
+#include <CF++.hpp>
+
+/*
+ * Byte runs shorter than this are merged into the piece preceding the
+ * insertion point, so a sequence of small edits doesn't leave one node per
+ * edit behind.
+ */
+#ifndef CFPP_DATA_ROPE_SMALL_CHUNK
+#define CFPP_DATA_ROPE_SMALL_CHUNK  1024
+#endif
+
+static UInt32 __Priority();
+static UInt32 __Priority()
+{
+    static thread_local UInt32 state = 0x9E3779B9;
+    
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    
+    return state;
+}
+
+namespace CF
+{
+    /*
+     * Persistent treap keyed by byte offset. Each node is a piece referencing
+     * a range of an immutable CFData, so splitting a piece never copies bytes,
+     * and edits only rebuild the nodes along the affected path. Copies and
+     * slices share everything else.
+     * Nodes hold the CFData itself rather than a CF::Data, as they are shared
+     * across threads and must never see the bytes change under them.
+     */
+    struct DataRope::Node
+    {
+        typedef std::shared_ptr< const Node > Pointer;
+        
+        Node():
+            data( nullptr )
+        {}
+        
+        ~Node()
+        {
+            if( this->data != nullptr )
+            {
+                CFRelease( this->data );
+            }
+        }
+        
+        static Pointer Make( CFDataRef data, CFIndex offset, CFIndex length, UInt32 priority, const Pointer & left, const Pointer & right )
+        {
+            std::shared_ptr< Node > node( std::make_shared< Node >() );
+            
+            node->data     = static_cast< CFDataRef >( CFRetain( data ) );
+            node->offset   = offset;
+            node->length   = length;
+            node->priority = priority;
+            node->left     = left;
+            node->right    = right;
+            node->total    = Length( left ) + length + Length( right );
+            node->count    = Count( left )  + 1      + Count( right );
+            
+            return node;
+        }
+        
+        static Pointer Leaf( CFDataRef data, CFIndex offset, CFIndex length )
+        {
+            if( length <= 0 )
+            {
+                return nullptr;
+            }
+            
+            return Make( data, offset, length, __Priority(), nullptr, nullptr );
+        }
+        
+        static CFIndex Length( const Pointer & node )
+        {
+            return ( node == nullptr ) ? 0 : node->total;
+        }
+        
+        static CFIndex Count( const Pointer & node )
+        {
+            return ( node == nullptr ) ? 0 : node->count;
+        }
+        
+        static void Split( Pointer node, CFIndex location, Pointer & left, Pointer & right )
+        {
+            CFIndex l;
+            Pointer p;
+            
+            if( node == nullptr )
+            {
+                left  = nullptr;
+                right = nullptr;
+                
+                return;
+            }
+            
+            l = Length( node->left );
+            
+            if( location <= l )
+            {
+                Split( node->left, location, left, p );
+                
+                right = Make( node->data, node->offset, node->length, node->priority, p, node->right );
+            }
+            else if( location >= l + node->length )
+            {
+                Split( node->right, location - l - node->length, p, right );
+                
+                left = Make( node->data, node->offset, node->length, node->priority, node->left, p );
+            }
+            else
+            {
+                /*
+                 * Cut inside this piece. The right half gets a fresh priority,
+                 * otherwise a piece cut by many edits would leave a run of
+                 * equal priorities and the tree would degrade into a list.
+                 */
+                left  = Make( node->data, node->offset, location - l, node->priority, node->left, nullptr );
+                right = Merge( Leaf( node->data, node->offset + location - l, node->length - location + l ), node->right );
+            }
+        }
+        
+        static Pointer Merge( const Pointer & left, const Pointer & right )
+        {
+            if( left == nullptr )
+            {
+                return right;
+            }
+            
+            if( right == nullptr )
+            {
+                return left;
+            }
+            
+            if( left->priority > right->priority )
+            {
+                return Make( left->data, left->offset, left->length, left->priority, left->left, Merge( left->right, right ) );
+            }
+            
+            return Make( right->data, right->offset, right->length, right->priority, Merge( left, right->left ), right->right );
+        }
+        
+        template< typename F >
+        static bool Visit( const Pointer & node, CFIndex location, CFIndex length, F & f )
+        {
+            CFIndex l;
+            CFIndex start;
+            CFIndex end;
+            
+            if( node == nullptr || length <= 0 )
+            {
+                return true;
+            }
+            
+            l = Length( node->left );
+            
+            if( location < l && Visit( node->left, location, std::min( length, l - location ), f ) == false )
+            {
+                return false;
+            }
+            
+            start = std::max( location, l );
+            end   = std::min( location + length, l + node->length );
+            
+            if( start < end && f( CFDataGetBytePtr( node->data ) + node->offset + start - l, end - start ) == false )
+            {
+                return false;
+            }
+            
+            start = std::max( location, l + node->length );
+            
+            return Visit( node->right, start - l - node->length, location + length - start, f );
+        }
+        
+        CFDataRef data;
+        CFIndex   offset;
+        CFIndex   length;
+        CFIndex   total;
+        CFIndex   count;
+        UInt32    priority;
+        Pointer   left;
+        Pointer   right;
+    };
+    
+    DataRope::DataRope()
+    {}
+    
+    DataRope::DataRope( const DataRope & value ):
+        _root( value._root )
+    {}
+    
+    DataRope::DataRope( const Data & value )
+    {
+        CFDataRef data;
+        
+        if( value.GetCFObject() == nullptr )
+        {
+            return;
+        }
+        
+        /* Only copies the bytes if the Data is still mutable */
+        data = CFDataCreateCopy( static_cast< CFAllocatorRef >( nullptr ), static_cast< CFDataRef >( value.GetCFObject() ) );
+        
+        if( data == nullptr )
+        {
+            return;
+        }
+        
+        this->_root = Node::Leaf( data, 0, CFDataGetLength( data ) );
+        
+        CFRelease( data );
+    }
+    
+    DataRope::DataRope( const DataView & value )
+    {
+        this->Append( value );
+    }
+    
+    DataRope::DataRope( DataRope && value ) noexcept:
+        _root( std::move( value._root ) )
+    {}
+    
+    DataRope::DataRope( std::shared_ptr< const Node > root ):
+        _root( root )
+    {}
+    
+    DataRope::~DataRope()
+    {}
+    
+    DataRope & DataRope::operator =( DataRope value )
+    {
+        swap( *( this ), value );
+        
+        return *( this );
+    }
+    
+    DataRope & DataRope::operator += ( const Data & value )
+    {
+        this->Append( value );
+        
+        return *( this );
+    }
+    
+    DataRope & DataRope::operator += ( const DataView & value )
+    {
+        this->Append( value );
+        
+        return *( this );
+    }
+    
+    DataRope & DataRope::operator += ( const DataRope & value )
+    {
+        this->Append( value );
+        
+        return *( this );
+    }
+    
+    Data::Byte DataRope::operator [] ( CFIndex index ) const
+    {
+        Node::Pointer node;
+        CFIndex       l;
+        
+        if( index < 0 || index >= this->GetLength() )
+        {
+            return 0;
+        }
+        
+        node = this->_root;
+        
+        while( node != nullptr )
+        {
+            l = Node::Length( node->left );
+            
+            if( index < l )
+            {
+                node = node->left;
+            }
+            else if( index < l + node->length )
+            {
+                return CFDataGetBytePtr( node->data )[ node->offset + index - l ];
+            }
+            else
+            {
+                index -= l + node->length;
+                node   = node->right;
+            }
+        }
+        
+        return 0;
+    }
+    
+    CFIndex DataRope::GetLength() const
+    {
+        return Node::Length( this->_root );
+    }
+    
+    CFIndex DataRope::GetChunkCount() const
+    {
+        return Node::Count( this->_root );
+    }
+    
+    bool DataRope::IsEmpty() const
+    {
+        return this->_root == nullptr;
+    }
+    
+    void DataRope::GetBytes( CFRange range, Data::Byte * bytes ) const
+    {
+        if( bytes == nullptr || range.location < 0 || range.length < 0 || range.location + range.length > this->GetLength() )
+        {
+            return;
+        }
+        
+        auto f = [ & ]( const Data::Byte * bp, CFIndex length )
+        {
+            memcpy( bytes, bp, static_cast< size_t >( length ) );
+            
+            bytes += length;
+            
+            return true;
+        };
+        
+        Node::Visit( this->_root, range.location, range.length, f );
+    }
+    
+    DataRope DataRope::Slice( CFRange range ) const
+    {
+        Node::Pointer left;
+        Node::Pointer middle;
+        Node::Pointer right;
+        
+        if( range.location < 0 || range.length < 0 || range.location + range.length > this->GetLength() )
+        {
+            return DataRope();
+        }
+        
+        Node::Split( this->_root, range.location, left, right );
+        Node::Split( right, range.length, middle, right );
+        
+        return DataRope( middle );
+    }
+    
+    std::vector< DataView > DataRope::GetChunks() const
+    {
+        std::vector< DataView > chunks;
+        
+        auto f = [ & ]( const Data::Byte * bp, CFIndex length )
+        {
+            chunks.push_back( DataView( bp, length ) );
+            
+            return true;
+        };
+        
+        chunks.reserve( static_cast< size_t >( this->GetChunkCount() ) );
+        Node::Visit( this->_root, 0, this->GetLength(), f );
+        
+        return chunks;
+    }
+    
+    Data DataRope::GetData() const
+    {
+        Data      data;
+        CFDataRef cfData;
+        
+        if( this->_root == nullptr )
+        {
+            return data;
+        }
+        
+        /* A rope holding a single untouched piece hands its bytes back without copying */
+        if( this->_root->count == 1 && this->_root->offset == 0 && this->_root->length == CFDataGetLength( this->_root->data ) )
+        {
+            cfData = static_cast< CFDataRef >( CFRetain( this->_root->data ) );
+            
+            return Data::NoCopy( CFDataGetBytePtr( cfData ), CFDataGetLength( cfData ), [ = ]( const Data::Byte * ) { CFRelease( cfData ); } );
+        }
+        
+        data = Data( this->GetLength() );
+        
+        auto f = [ & ]( const Data::Byte * bp, CFIndex length )
+        {
+            data.AppendBytes( bp, length );
+            
+            return true;
+        };
+        
+        Node::Visit( this->_root, 0, this->GetLength(), f );
+        
+        return data;
+    }
+    
+    bool DataRope::Write( WriteStream & stream ) const
+    {
+        auto f = [ & ]( const Data::Byte * bp, CFIndex length )
+        {
+            return stream.WriteAll( bp, length );
+        };
+        
+        return Node::Visit( this->_root, 0, this->GetLength(), f );
+    }
+    
+    void DataRope::Append( const Data & data )
+    {
+        this->Insert( this->GetLength(), data );
+    }
+    
+    void DataRope::Append( const DataView & data )
+    {
+        this->Insert( this->GetLength(), data );
+    }
+    
+    void DataRope::Append( const DataRope & data )
+    {
+        this->Insert( this->GetLength(), data );
+    }
+    
+    void DataRope::Insert( CFIndex location, const Data & data )
+    {
+        if( data.GetLength() < CFPP_DATA_ROPE_SMALL_CHUNK )
+        {
+            this->Insert( location, DataView( data ) );
+            
+            return;
+        }
+        
+        this->Insert( location, DataRope( data ) );
+    }
+    
+    void DataRope::Insert( CFIndex location, const DataView & data )
+    {
+        Node::Pointer left;
+        Node::Pointer right;
+        Node::Pointer last;
+        Node::Pointer    leaf;
+        CFMutableDataRef bytes;
+        
+        if( location < 0 || location > this->GetLength() || data.GetLength() == 0 )
+        {
+            return;
+        }
+        
+        bytes = CFDataCreateMutable( static_cast< CFAllocatorRef >( nullptr ), 0 );
+        
+        if( bytes == nullptr )
+        {
+            return;
+        }
+        
+        Node::Split( this->_root, location, left, right );
+        
+        last = left;
+        
+        while( last != nullptr && last->right != nullptr )
+        {
+            last = last->right;
+        }
+        
+        if( last != nullptr && last->length + data.GetLength() <= CFPP_DATA_ROPE_SMALL_CHUNK )
+        {
+            CFDataAppendBytes( bytes, CFDataGetBytePtr( last->data ) + last->offset, last->length );
+            Node::Split( left, Node::Length( left ) - last->length, left, last );
+        }
+        
+        CFDataAppendBytes( bytes, data.GetBytePtr(), data.GetLength() );
+        
+        /* Nothing else references the new bytes, so the piece can't change */
+        leaf        = Node::Leaf( bytes, 0, CFDataGetLength( bytes ) );
+        this->_root = Node::Merge( Node::Merge( left, leaf ), right );
+        
+        CFRelease( bytes );
+    }
+    
+    void DataRope::Insert( CFIndex location, const DataRope & data )
+    {
+        Node::Pointer left;
+        Node::Pointer right;
+        Node::Pointer root;
+        
+        if( location < 0 || location > this->GetLength() )
+        {
+            return;
+        }
+        
+        root = data._root;
+        
+        Node::Split( this->_root, location, left, right );
+        
+        this->_root = Node::Merge( Node::Merge( left, root ), right );
+    }
+    
+    void DataRope::Delete( CFRange range )
+    {
+        Node::Pointer left;
+        Node::Pointer middle;
+        Node::Pointer right;
+        
+        if( range.location < 0 || range.length <= 0 || range.location + range.length > this->GetLength() )
+        {
+            return;
+        }
+        
+        Node::Split( this->_root, range.location, left, right );
+        Node::Split( right, range.length, middle, right );
+        
+        this->_root = Node::Merge( left, right );
+    }
+    
+    void DataRope::Replace( CFRange range, const Data & data )
+    {
+        this->Replace( range, DataRope( data ) );
+    }
+    
+    void DataRope::Replace( CFRange range, const DataView & data )
+    {
+        this->Replace( range, DataRope( data ) );
+    }
+    
+    void DataRope::Replace( CFRange range, const DataRope & data )
+    {
+        DataRope rope( data );
+        
+        if( range.location < 0 || range.length < 0 || range.location + range.length > this->GetLength() )
+        {
+            return;
+        }
+        
+        this->Delete( range );
+        this->Insert( range.location, rope );
+    }
+    
+    void DataRope::Clear()
+    {
+        this->_root = nullptr;
+    }
+    
+    void swap( DataRope & v1, DataRope & v2 ) noexcept
+    {
+        using std::swap;
+        
+        swap( v1._root, v2._root );
+    }
+}
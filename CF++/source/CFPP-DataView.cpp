@@ -0,0 +1,668 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+/*!
+ * @file        CFPP-DataView.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    CoreFoundation++ non-owning view over CFDataRef bytes
+ */
+
+#include <CF++.hpp>
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+#include <emmintrin.h>
+#define CFPP_DATA_VIEW_SSE2
+#endif
+
+#if defined( __AVX2__ )
+#include <immintrin.h>
+#define CFPP_DATA_VIEW_AVX2
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+/*
+ * Needles longer than this are searched with Horspool, as the first/last
+ * byte filter degrades when long needles share many candidate positions.
+ */
+#define CFPP_DATA_VIEW_HORSPOOL_THRESHOLD   32
+
+/*
+ * FindAny compares each block against every distinct first byte; past this
+ * count a single table lookup per byte is cheaper.
+ */
+#define CFPP_DATA_VIEW_FIND_ANY_SIMD_BYTES  8
+
+static unsigned int __CountTrailingZeros( unsigned int mask );
+static unsigned int __CountTrailingZeros( unsigned int mask )
+{
+    #ifdef _MSC_VER
+    
+    unsigned long i;
+    
+    _BitScanForward( &i, mask );
+    
+    return static_cast< unsigned int >( i );
+    
+    #else
+    
+    return static_cast< unsigned int >( __builtin_ctz( mask ) );
+    
+    #endif
+}
+
+static const UInt8 * __SearchFilter( const UInt8 * bytes, size_t length, const UInt8 * needle, size_t needleLength );
+static const UInt8 * __SearchFilter( const UInt8 * bytes, size_t length, const UInt8 * needle, size_t needleLength )
+{
+    size_t i;
+    size_t count;
+    
+    i     = 0;
+    count = length - needleLength + 1;
+    
+    /*
+     * Candidates are positions where both the first and the last byte of
+     * the needle match; only those are compared in full.
+     */
+    #if defined( CFPP_DATA_VIEW_AVX2 )
+    
+    {
+        __m256i      first;
+        __m256i      last;
+        __m256i      a;
+        __m256i      b;
+        unsigned int mask;
+        
+        first = _mm256_set1_epi8( static_cast< char >( needle[ 0 ] ) );
+        last  = _mm256_set1_epi8( static_cast< char >( needle[ needleLength - 1 ] ) );
+        
+        for( ; i + 32 <= count; i += 32 )
+        {
+            a    = _mm256_loadu_si256( reinterpret_cast< const __m256i * >( bytes + i ) );
+            b    = _mm256_loadu_si256( reinterpret_cast< const __m256i * >( bytes + i + needleLength - 1 ) );
+            mask = static_cast< unsigned int >( _mm256_movemask_epi8( _mm256_and_si256( _mm256_cmpeq_epi8( a, first ), _mm256_cmpeq_epi8( b, last ) ) ) );
+            
+            while( mask != 0 )
+            {
+                const UInt8 * p( bytes + i + __CountTrailingZeros( mask ) );
+                
+                if( memcmp( p + 1, needle + 1, needleLength - 2 ) == 0 )
+                {
+                    return p;
+                }
+                
+                mask &= mask - 1;
+            }
+        }
+    }
+    
+    #endif
+    
+    #if defined( CFPP_DATA_VIEW_SSE2 )
+    
+    {
+        __m128i      first;
+        __m128i      last;
+        __m128i      a;
+        __m128i      b;
+        unsigned int mask;
+        
+        first = _mm_set1_epi8( static_cast< char >( needle[ 0 ] ) );
+        last  = _mm_set1_epi8( static_cast< char >( needle[ needleLength - 1 ] ) );
+        
+        for( ; i + 16 <= count; i += 16 )
+        {
+            a    = _mm_loadu_si128( reinterpret_cast< const __m128i * >( bytes + i ) );
+            b    = _mm_loadu_si128( reinterpret_cast< const __m128i * >( bytes + i + needleLength - 1 ) );
+            mask = static_cast< unsigned int >( _mm_movemask_epi8( _mm_and_si128( _mm_cmpeq_epi8( a, first ), _mm_cmpeq_epi8( b, last ) ) ) );
+            
+            while( mask != 0 )
+            {
+                const UInt8 * p( bytes + i + __CountTrailingZeros( mask ) );
+                
+                if( memcmp( p + 1, needle + 1, needleLength - 2 ) == 0 )
+                {
+                    return p;
+                }
+                
+                mask &= mask - 1;
+            }
+        }
+    }
+    
+    #endif
+    
+    for( ; i < count; i++ )
+    {
+        if( bytes[ i ] == needle[ 0 ] && bytes[ i + needleLength - 1 ] == needle[ needleLength - 1 ] && memcmp( bytes + i + 1, needle + 1, needleLength - 2 ) == 0 )
+        {
+            return bytes + i;
+        }
+    }
+    
+    return nullptr;
+}
+
+static const UInt8 * __SearchHorspool( const UInt8 * bytes, size_t length, const UInt8 * needle, size_t needleLength );
+static const UInt8 * __SearchHorspool( const UInt8 * bytes, size_t length, const UInt8 * needle, size_t needleLength )
+{
+    size_t skip[ 256 ];
+    size_t i;
+    size_t pos;
+    UInt8  c;
+    
+    for( i = 0; i < 256; i++ )
+    {
+        skip[ i ] = needleLength;
+    }
+    
+    for( i = 0; i < needleLength - 1; i++ )
+    {
+        skip[ needle[ i ] ] = needleLength - 1 - i;
+    }
+    
+    for( pos = 0; pos <= length - needleLength; pos += skip[ c ] )
+    {
+        c = bytes[ pos + needleLength - 1 ];
+        
+        if( c == needle[ needleLength - 1 ] && bytes[ pos ] == needle[ 0 ] && memcmp( bytes + pos, needle, needleLength - 1 ) == 0 )
+        {
+            return bytes + pos;
+        }
+    }
+    
+    return nullptr;
+}
+
+static const UInt8 * __Search( const UInt8 * bytes, size_t length, const UInt8 * needle, size_t needleLength );
+static const UInt8 * __Search( const UInt8 * bytes, size_t length, const UInt8 * needle, size_t needleLength )
+{
+    if( needleLength == 0 || needleLength > length )
+    {
+        return nullptr;
+    }
+    
+    if( needleLength == 1 )
+    {
+        return static_cast< const UInt8 * >( memchr( bytes, needle[ 0 ], length ) );
+    }
+    
+    if( needleLength > CFPP_DATA_VIEW_HORSPOOL_THRESHOLD )
+    {
+        return __SearchHorspool( bytes, length, needle, needleLength );
+    }
+    
+    return __SearchFilter( bytes, length, needle, needleLength );
+}
+
+static const UInt8 * __SearchBackwards( const UInt8 * bytes, size_t length, const UInt8 * needle, size_t needleLength );
+static const UInt8 * __SearchBackwards( const UInt8 * bytes, size_t length, const UInt8 * needle, size_t needleLength )
+{
+    const UInt8 * p;
+    
+    if( needleLength == 0 || needleLength > length )
+    {
+        return nullptr;
+    }
+    
+    for( p = bytes + ( length - needleLength ); ; p-- )
+    {
+        if( p[ 0 ] == needle[ 0 ] && memcmp( p, needle, needleLength ) == 0 )
+        {
+            return p;
+        }
+        
+        if( p == bytes )
+        {
+            break;
+        }
+    }
+    
+    return nullptr;
+}
+
+static bool __MatchesAny( const UInt8 * p, const UInt8 * end, const std::vector< CF::DataView > & needles, CFIndex * index );
+static bool __MatchesAny( const UInt8 * p, const UInt8 * end, const std::vector< CF::DataView > & needles, CFIndex * index )
+{
+    size_t i;
+    
+    for( i = 0; i < needles.size(); i++ )
+    {
+        const CF::DataView & n( needles[ i ] );
+        
+        if( n.IsEmpty() || n[ 0 ] != *( p ) || n.GetLength() > end - p )
+        {
+            continue;
+        }
+        
+        if( memcmp( p, n.GetBytePtr(), static_cast< size_t >( n.GetLength() ) ) == 0 )
+        {
+            *( index ) = static_cast< CFIndex >( i );
+            
+            return true;
+        }
+    }
+    
+    return false;
+}
+
+static const UInt8 * __SearchAny( const UInt8 * bytes, size_t length, const std::vector< CF::DataView > & needles, CFIndex * index );
+static const UInt8 * __SearchAny( const UInt8 * bytes, size_t length, const std::vector< CF::DataView > & needles, CFIndex * index )
+{
+    bool                 table[ 256 ];
+    std::vector< UInt8 > firsts;
+    const UInt8        * end;
+    size_t               i;
+    
+    memset( table, 0, sizeof( table ) );
+    
+    for( const CF::DataView & n: needles )
+    {
+        if( n.IsEmpty() == false && table[ n[ 0 ] ] == false )
+        {
+            table[ n[ 0 ] ] = true;
+            
+            firsts.push_back( n[ 0 ] );
+        }
+    }
+    
+    if( firsts.empty() )
+    {
+        return nullptr;
+    }
+    
+    end = bytes + length;
+    i   = 0;
+    
+    #if defined( CFPP_DATA_VIEW_SSE2 )
+    
+    if( firsts.size() <= CFPP_DATA_VIEW_FIND_ANY_SIMD_BYTES )
+    {
+        __m128i      set[ CFPP_DATA_VIEW_FIND_ANY_SIMD_BYTES ];
+        __m128i      b;
+        __m128i      m;
+        unsigned int mask;
+        size_t       j;
+        
+        for( j = 0; j < firsts.size(); j++ )
+        {
+            set[ j ] = _mm_set1_epi8( static_cast< char >( firsts[ j ] ) );
+        }
+        
+        for( ; i + 16 <= length; i += 16 )
+        {
+            b = _mm_loadu_si128( reinterpret_cast< const __m128i * >( bytes + i ) );
+            m = _mm_cmpeq_epi8( b, set[ 0 ] );
+            
+            for( j = 1; j < firsts.size(); j++ )
+            {
+                m = _mm_or_si128( m, _mm_cmpeq_epi8( b, set[ j ] ) );
+            }
+            
+            mask = static_cast< unsigned int >( _mm_movemask_epi8( m ) );
+            
+            while( mask != 0 )
+            {
+                const UInt8 * p( bytes + i + __CountTrailingZeros( mask ) );
+                
+                if( __MatchesAny( p, end, needles, index ) )
+                {
+                    return p;
+                }
+                
+                mask &= mask - 1;
+            }
+        }
+    }
+    
+    #endif
+    
+    for( ; i < length; i++ )
+    {
+        if( table[ bytes[ i ] ] && __MatchesAny( bytes + i, end, needles, index ) )
+        {
+            return bytes + i;
+        }
+    }
+    
+    return nullptr;
+}
+
+namespace CF
+{
+    DataView DataView::Retaining( const Data & data )
+    {
+        std::shared_ptr< const Data > copy;
+        
+        if( data.GetCFObject() == nullptr )
+        {
+            return DataView();
+        }
+        
+        /*
+         * The copy shares the parent's buffer, so the parent detaches on its
+         * next mutation instead of moving the bytes under the view. Buffers
+         * the parent can't share are copied right away.
+         */
+        copy = std::make_shared< const Data >( data );
+        
+        return DataView( copy->GetBytePtr(), copy->GetLength(), copy );
+    }
+    
+    DataView DataView::Retaining( const Data & data, CFRange range )
+    {
+        return Retaining( data ).Slice( range );
+    }
+    
+    DataView::DataView():
+        _bp( nullptr ),
+        _length( 0 ),
+        _data( nullptr )
+    {}
+    
+    DataView::DataView( const DataView & value ):
+        DataView( value._bp, value._length, value._data )
+    {}
+    
+    DataView::DataView( const Data & data ):
+        DataView( data.GetBytePtr(), data.GetLength() )
+    {}
+    
+    DataView::DataView( const Data & data, CFRange range ):
+        DataView( DataView( data ).Slice( range ) )
+    {}
+    
+    DataView::DataView( const Data::Byte * bytes, CFIndex length ):
+        _bp( ( length > 0 ) ? bytes : nullptr ),
+        _length( ( bytes != nullptr && length > 0 ) ? length : 0 ),
+        _data( nullptr )
+    {}
+    
+    DataView::DataView( const Data::Byte * bytes, CFIndex length, std::shared_ptr< const Data > data ):
+        DataView( bytes, length )
+    {
+        this->_data = data;
+    }
+    
+    DataView::DataView( DataView && value ) noexcept:
+        _bp( value._bp ),
+        _length( value._length ),
+        _data( std::move( value._data ) )
+    {
+        value._bp       = nullptr;
+        value._length   = 0;
+    }
+    
+    #if __cplusplus >= 202002L
+    DataView::DataView( std::span< const Data::Byte > value ):
+        DataView( value.data(), static_cast< CFIndex >( value.size() ) )
+    {}
+    #endif
+    
+    DataView::~DataView()
+    {}
+    
+    DataView & DataView::operator =( DataView value )
+    {
+        swap( *( this ), value );
+        
+        return *( this );
+    }
+    
+    bool DataView::operator == ( const DataView & value ) const
+    {
+        if( this->_length != value._length )
+        {
+            return false;
+        }
+        
+        return this->Compare( value ) == 0;
+    }
+    
+    bool DataView::operator != ( const DataView & value ) const
+    {
+        return !operator ==( value );
+    }
+    
+    bool DataView::operator < ( const DataView & value ) const
+    {
+        return this->Compare( value ) < 0;
+    }
+    
+    Data::Byte DataView::operator [] ( CFIndex index ) const
+    {
+        if( index < 0 || index >= this->_length )
+        {
+            return 0;
+        }
+        
+        return this->_bp[ index ];
+    }
+    
+    const Data::Byte * DataView::GetBytePtr() const
+    {
+        return this->_bp;
+    }
+    
+    CFIndex DataView::GetLength() const
+    {
+        return this->_length;
+    }
+    
+    bool DataView::IsEmpty() const
+    {
+        return this->_length == 0;
+    }
+    
+    bool DataView::IsRetaining() const
+    {
+        return this->_data != nullptr;
+    }
+    
+    int DataView::Compare( const DataView & value ) const
+    {
+        CFIndex length;
+        int     res;
+        
+        length = std::min( this->_length, value._length );
+        res    = ( length == 0 || this->_bp == value._bp ) ? 0 : memcmp( this->_bp, value._bp, static_cast< size_t >( length ) );
+        
+        if( res != 0 )
+        {
+            return ( res < 0 ) ? -1 : 1;
+        }
+        
+        if( this->_length == value._length )
+        {
+            return 0;
+        }
+        
+        return ( this->_length < value._length ) ? -1 : 1;
+    }
+    
+    DataView DataView::Slice( CFIndex location ) const
+    {
+        return this->Slice( CFRangeMake( location, this->_length - location ) );
+    }
+    
+    DataView DataView::Slice( CFRange range ) const
+    {
+        if( range.location < 0 || range.location > this->_length || range.length < 0 )
+        {
+            return DataView();
+        }
+        
+        range.length = std::min( range.length, this->_length - range.location );
+        
+        if( range.length == 0 )
+        {
+            return DataView();
+        }
+        
+        return DataView( this->_bp + range.location, range.length, this->_data );
+    }
+    
+    CFRange DataView::Find( const DataView & data ) const
+    {
+        return this->Find( data, CFRangeMake( 0, this->_length ), 0 );
+    }
+    
+    CFRange DataView::Find( const DataView & data, CFRange range, CFDataSearchFlags flags ) const
+    {
+        const UInt8 * p;
+        CFRange       r;
+        
+        r.location = kCFNotFound;
+        r.length   = 0;
+        
+        if( range.location < 0 || range.length < 0 || range.location > this->_length || data._length == 0 )
+        {
+            return r;
+        }
+        
+        range.length = std::min( range.length, this->_length - range.location );
+        
+        if( data._length > range.length )
+        {
+            return r;
+        }
+        
+        if( flags & kCFDataSearchAnchored )
+        {
+            p = this->_bp + range.location;
+            
+            if( flags & kCFDataSearchBackwards )
+            {
+                p += range.length - data._length;
+            }
+            
+            p = ( memcmp( p, data._bp, static_cast< size_t >( data._length ) ) == 0 ) ? p : nullptr;
+        }
+        else if( flags & kCFDataSearchBackwards )
+        {
+            p = __SearchBackwards( this->_bp + range.location, static_cast< size_t >( range.length ), data._bp, static_cast< size_t >( data._length ) );
+        }
+        else
+        {
+            p = __Search( this->_bp + range.location, static_cast< size_t >( range.length ), data._bp, static_cast< size_t >( data._length ) );
+        }
+        
+        if( p != nullptr )
+        {
+            r.location = p - this->_bp;
+            r.length   = data._length;
+        }
+        
+        return r;
+    }
+    
+    CFRange DataView::FindAny( const std::vector< DataView > & data ) const
+    {
+        return this->FindAny( data, CFRangeMake( 0, this->_length ), nullptr );
+    }
+    
+    CFRange DataView::FindAny( const std::vector< DataView > & data, CFRange range, CFIndex * index ) const
+    {
+        const UInt8 * p;
+        CFIndex       i;
+        CFRange       r;
+        
+        r.location = kCFNotFound;
+        r.length   = 0;
+        i          = kCFNotFound;
+        
+        if( range.location >= 0 && range.length >= 0 && range.location <= this->_length )
+        {
+            range.length = std::min( range.length, this->_length - range.location );
+            p            = __SearchAny( this->_bp + range.location, static_cast< size_t >( range.length ), data, &i );
+            
+            if( p != nullptr )
+            {
+                r.location = p - this->_bp;
+                r.length   = data[ static_cast< size_t >( i ) ].GetLength();
+            }
+        }
+        
+        if( index != nullptr )
+        {
+            *( index ) = i;
+        }
+        
+        return r;
+    }
+    
+    bool DataView::HasPrefix( const DataView & data ) const
+    {
+        return data._length <= this->_length && this->Slice( CFRangeMake( 0, data._length ) ) == data;
+    }
+    
+    bool DataView::HasSuffix( const DataView & data ) const
+    {
+        return data._length <= this->_length && this->Slice( this->_length - data._length ) == data;
+    }
+    
+    Data DataView::GetData() const
+    {
+        if( this->_bp == nullptr )
+        {
+            return Data();
+        }
+        
+        return Data( this->_bp, this->_length );
+    }
+    
+    #if __cplusplus >= 202002L
+    std::span< const Data::Byte > DataView::GetSpan() const
+    {
+        return std::span< const Data::Byte >( this->_bp, static_cast< size_t >( this->_length ) );
+    }
+    
+    DataView::operator std::span< const Data::Byte > () const
+    {
+        return this->GetSpan();
+    }
+    #endif
+    
+    const Data::Byte * DataView::begin() const
+    {
+        return this->_bp;
+    }
+    
+    const Data::Byte * DataView::end() const
+    {
+        return this->_bp + this->_length;
+    }
+    
+    void swap( DataView & v1, DataView & v2 ) noexcept
+    {
+        using std::swap;
+        
+        swap( v1._bp,     v2._bp );
+        swap( v1._length, v2._length );
+        swap( v1._data,   v2._data );
+    }
+}
@@ -328,6 +328,11 @@ namespace CF
         return this->GetValue( key );
     }
     
+    CFTypeRef Dictionary::operator [] ( const StaticString & key ) const
+    {
+        return this->GetValue( key );
+    }
+    
     CFTypeID Dictionary::GetTypeID() const
     {
         return CFDictionaryGetTypeID();
@@ -358,6 +363,11 @@ namespace CF
         return this->ContainsKey( key.GetCFObject() );
     }
     
+    bool Dictionary::ContainsKey( const StaticString & key ) const
+    {
+        return this->ContainsKey( key.GetCFObject() );
+    }
+    
     bool Dictionary::ContainsValue( CFTypeRef value ) const
     {
         if( this->_cfObject == nullptr || value == nullptr )
@@ -403,6 +413,11 @@ namespace CF
         return this->GetValue( key.GetCFObject() );
     }
     
+    CFTypeRef Dictionary::GetValue( const StaticString & key ) const
+    {
+        return this->GetValue( key.GetCFObject() );
+    }
+    
     void Dictionary::AddValue( CFTypeRef key, CFTypeRef value )
     {
         if( this->_cfObject == nullptr || key == nullptr || value == nullptr )
@@ -423,6 +438,11 @@ namespace CF
         this->AddValue( key.GetCFObject(), value );
     }
     
+    void Dictionary::AddValue( const StaticString & key, CFTypeRef value )
+    {
+        this->AddValue( key.GetCFObject(), value );
+    }
+    
     void Dictionary::RemoveValue( CFTypeRef key )
     {
         if( this->_cfObject == nullptr || key == nullptr )
@@ -443,6 +463,11 @@ namespace CF
         this->RemoveValue( key.GetCFObject() );
     }
     
+    void Dictionary::RemoveValue( const StaticString & key )
+    {
+        this->RemoveValue( key.GetCFObject() );
+    }
+    
     void Dictionary::ReplaceValue( CFTypeRef key, CFTypeRef value )
     {
         if( this->_cfObject == nullptr || key == nullptr || value == nullptr )
@@ -463,6 +488,11 @@ namespace CF
         this->ReplaceValue( key.GetCFObject(), value );
     }
     
+    void Dictionary::ReplaceValue( const StaticString & key, CFTypeRef value )
+    {
+        this->ReplaceValue( key.GetCFObject(), value );
+    }
+    
     void Dictionary::SetValue( CFTypeRef key, CFTypeRef value )
     {
         if( this->_cfObject == nullptr || key == nullptr || value == nullptr )
@@ -483,6 +513,11 @@ namespace CF
         this->SetValue( key.GetCFObject(), value );
     }
     
+    void Dictionary::SetValue( const StaticString & key, CFTypeRef value )
+    {
+        this->SetValue( key.GetCFObject(), value );
+    }
+    
     void Dictionary::AddValue( CFTypeRef key, const char * value )
     {
         this->AddValue( key, String( value ) );
@@ -498,6 +533,11 @@ namespace CF
         this->AddValue( key, String( value ) );
     }
     
+    void Dictionary::AddValue( const StaticString & key, const char * value )
+    {
+        this->AddValue( key, String( value ) );
+    }
+    
     void Dictionary::ReplaceValue( CFTypeRef key, const char * value )
     {
         this->ReplaceValue( key, String( value ) );
@@ -513,6 +553,11 @@ namespace CF
         this->ReplaceValue( key, String( value ) );
     }
     
+    void Dictionary::ReplaceValue( const StaticString & key, const char * value )
+    {
+        this->ReplaceValue( key, String( value ) );
+    }
+    
     void Dictionary::SetValue( CFTypeRef key, const char * value )
     {
         this->SetValue( key, String( value ) );
@@ -528,6 +573,11 @@ namespace CF
         this->SetValue( key, String( value ) );
     }
     
+    void Dictionary::SetValue( const StaticString & key, const char * value )
+    {
+        this->SetValue( key, String( value ) );
+    }
+    
     Dictionary::Iterator Dictionary::begin() const
     {
         return Iterator( this->_cfObject, this->GetCount() );
@@ -0,0 +1,93 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        CFPP-Parallel.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Parallel algorithms over CF::Array
+ */
+
+#include <CF++.hpp>
+
+namespace CF
+{
+    std::vector< CFTypeRef > Parallel::GetValues( const Array & array )
+    {
+        std::vector< CFTypeRef > values;
+        CFArrayRef               cfArray;
+        
+        cfArray = static_cast< CFArrayRef >( array.GetCFObject() );
+        
+        if( cfArray == nullptr || CFArrayGetCount( cfArray ) == 0 )
+        {
+            return values;
+        }
+        
+        /* Values are borrowed: the array outlives the call, and its objects are only read concurrently */
+        values.resize( static_cast< size_t >( CFArrayGetCount( cfArray ) ) );
+        
+        CFArrayGetValues( cfArray, CFRangeMake( 0, static_cast< CFIndex >( values.size() ) ), values.data() );
+        
+        return values;
+    }
+    
+    size_t Parallel::GetChunkCount( size_t count, const ThreadPool & pool )
+    {
+        size_t chunks;
+        
+        if( count == 0 )
+        {
+            return 0;
+        }
+        
+        /*
+         * Small arrays stay in a single chunk, run on the calling thread.
+         * Larger ones get a few chunks per thread, so work stealing can
+         * even out elements that are slower to process than others.
+         */
+        chunks = ( count + CFPP_PARALLEL_MIN_CHUNK - 1 ) / CFPP_PARALLEL_MIN_CHUNK;
+        
+        return std::min( chunks, pool.GetThreadCount() * CFPP_PARALLEL_CHUNKS_PER_THREAD );
+    }
+    
+    size_t Parallel::GetChunkBound( size_t count, size_t chunks, size_t chunk )
+    {
+        if( chunks == 0 )
+        {
+            return 0;
+        }
+        
+        return static_cast< size_t >( ( static_cast< unsigned long long >( count ) * chunk ) / chunks );
+    }
+    
+    CFTypeRef Parallel::GetCFObject( const Type & value )
+    {
+        return value.GetCFObject();
+    }
+    
+    CFTypeRef Parallel::GetCFObject( CFTypeRef value )
+    {
+        return value;
+    }
+}
@@ -0,0 +1,247 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+/*!
+ * @file        CFPP-SHA256.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    CoreFoundation++ incremental SHA-256 digest
+ */
+
+#include <CF++.hpp>
+
+static const UInt32 __k[ 64 ] =
+{
+    0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5, 0x3956C25B, 0x59F111F1, 0x923F82A4, 0xAB1C5ED5,
+    0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3, 0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174,
+    0xE49B69C1, 0xEFBE4786, 0x0FC19DC6, 0x240CA1CC, 0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA,
+    0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7, 0xC6E00BF3, 0xD5A79147, 0x06CA6351, 0x14292967,
+    0x27B70A85, 0x2E1B2138, 0x4D2C6DFC, 0x53380D13, 0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85,
+    0xA2BFE8A1, 0xA81A664B, 0xC24B8B70, 0xC76C51A3, 0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070,
+    0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5, 0x391C0CB3, 0x4ED8AA4A, 0x5B9CCA4F, 0x682E6FF3,
+    0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208, 0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2
+};
+
+static inline UInt32 __RotateRight( UInt32 value, int bits );
+static inline UInt32 __RotateRight( UInt32 value, int bits )
+{
+    return ( value >> bits ) | ( value << ( 32 - bits ) );
+}
+
+static void __Compress( UInt32 * h, const UInt8 * p, const UInt8 * end );
+static void __Compress( UInt32 * h, const UInt8 * p, const UInt8 * end )
+{
+    UInt32 w[ 64 ];
+    UInt32 s[ 8 ];
+    UInt32 t1;
+    UInt32 t2;
+    int    i;
+    
+    for( ; p + 64 <= end; p += 64 )
+    {
+        for( i = 0; i < 16; i++ )
+        {
+            memcpy( &( w[ i ] ), p + i * 4, 4 );
+            
+            w[ i ] = CFSwapInt32BigToHost( w[ i ] );
+        }
+        
+        for( i = 16; i < 64; i++ )
+        {
+            t1     = __RotateRight( w[ i - 2 ], 17 ) ^ __RotateRight( w[ i - 2 ], 19 ) ^ ( w[ i - 2 ] >> 10 );
+            t2     = __RotateRight( w[ i - 15 ], 7 ) ^ __RotateRight( w[ i - 15 ], 18 ) ^ ( w[ i - 15 ] >> 3 );
+            w[ i ] = t1 + w[ i - 7 ] + t2 + w[ i - 16 ];
+        }
+        
+        memcpy( s, h, sizeof( s ) );
+        
+        for( i = 0; i < 64; i++ )
+        {
+            t1     = s[ 7 ] + ( __RotateRight( s[ 4 ], 6 ) ^ __RotateRight( s[ 4 ], 11 ) ^ __RotateRight( s[ 4 ], 25 ) ) + ( ( s[ 4 ] & s[ 5 ] ) ^ ( ~s[ 4 ] & s[ 6 ] ) ) + __k[ i ] + w[ i ];
+            t2     = ( __RotateRight( s[ 0 ], 2 ) ^ __RotateRight( s[ 0 ], 13 ) ^ __RotateRight( s[ 0 ], 22 ) ) + ( ( s[ 0 ] & s[ 1 ] ) ^ ( s[ 0 ] & s[ 2 ] ) ^ ( s[ 1 ] & s[ 2 ] ) );
+            s[ 7 ] = s[ 6 ];
+            s[ 6 ] = s[ 5 ];
+            s[ 5 ] = s[ 4 ];
+            s[ 4 ] = s[ 3 ] + t1;
+            s[ 3 ] = s[ 2 ];
+            s[ 2 ] = s[ 1 ];
+            s[ 1 ] = s[ 0 ];
+            s[ 0 ] = t1 + t2;
+        }
+        
+        for( i = 0; i < 8; i++ )
+        {
+            h[ i ] += s[ i ];
+        }
+    }
+}
+
+namespace CF
+{
+    SHA256::SHA256()
+    {
+        this->Reset();
+    }
+    
+    SHA256::SHA256( const SHA256 & value ):
+        _total( value._total ),
+        _bufferLength( value._bufferLength )
+    {
+        memcpy( this->_h,      value._h,      sizeof( this->_h ) );
+        memcpy( this->_buffer, value._buffer, sizeof( this->_buffer ) );
+    }
+    
+    SHA256::SHA256( SHA256 && value ) noexcept: SHA256( static_cast< const SHA256 & >( value ) )
+    {
+        value.Reset();
+    }
+    
+    SHA256::~SHA256()
+    {}
+    
+    SHA256 & SHA256::operator =( SHA256 value )
+    {
+        swap( *( this ), value );
+        
+        return *( this );
+    }
+    
+    SHA256 & SHA256::operator << ( const DataView & value )
+    {
+        this->Update( value );
+        
+        return *( this );
+    }
+    
+    void SHA256::Update( const Data::Byte * bytes, CFIndex length )
+    {
+        const UInt8 * p;
+        const UInt8 * end;
+        size_t        n;
+        
+        if( bytes == nullptr || length <= 0 )
+        {
+            return;
+        }
+        
+        p             = bytes;
+        end           = bytes + length;
+        this->_total += static_cast< UInt64 >( length );
+        
+        if( this->_bufferLength > 0 )
+        {
+            n = std::min( sizeof( this->_buffer ) - this->_bufferLength, static_cast< size_t >( length ) );
+            
+            memcpy( this->_buffer + this->_bufferLength, p, n );
+            
+            this->_bufferLength += n;
+            p                   += n;
+            
+            if( this->_bufferLength < sizeof( this->_buffer ) )
+            {
+                return;
+            }
+            
+            __Compress( this->_h, this->_buffer, this->_buffer + sizeof( this->_buffer ) );
+            
+            this->_bufferLength = 0;
+        }
+        
+        n = static_cast< size_t >( end - p ) & ~static_cast< size_t >( 63 );
+        
+        __Compress( this->_h, p, p + n );
+        
+        p += n;
+        
+        if( p < end )
+        {
+            memcpy( this->_buffer, p, static_cast< size_t >( end - p ) );
+            
+            this->_bufferLength = static_cast< size_t >( end - p );
+        }
+    }
+    
+    void SHA256::Update( const DataView & data )
+    {
+        this->Update( data.GetBytePtr(), data.GetLength() );
+    }
+    
+    Data SHA256::GetValue() const
+    {
+        UInt32 h[ 8 ];
+        UInt8  block[ 128 ];
+        UInt8  digest[ 32 ];
+        UInt64 bits;
+        size_t length;
+        size_t i;
+        
+        /* Pads a copy, so hashing can continue after reading the value */
+        memcpy( h,     this->_h,      sizeof( h ) );
+        memcpy( block, this->_buffer, this->_bufferLength );
+        
+        length                       = ( this->_bufferLength < 56 ) ? 64 : 128;
+        block[ this->_bufferLength ] = 0x80;
+        
+        memset( block + this->_bufferLength + 1, 0, length - this->_bufferLength - 1 );
+        
+        bits = CFSwapInt64HostToBig( this->_total * 8 );
+        
+        memcpy( block + length - 8, &bits, 8 );
+        
+        __Compress( h, block, block + length );
+        
+        for( i = 0; i < 8; i++ )
+        {
+            h[ i ] = CFSwapInt32HostToBig( h[ i ] );
+        }
+        
+        memcpy( digest, h, sizeof( digest ) );
+        
+        return Data( digest, sizeof( digest ) );
+    }
+    
+    void SHA256::Reset()
+    {
+        this->_h[ 0 ]       = 0x6A09E667;
+        this->_h[ 1 ]       = 0xBB67AE85;
+        this->_h[ 2 ]       = 0x3C6EF372;
+        this->_h[ 3 ]       = 0xA54FF53A;
+        this->_h[ 4 ]       = 0x510E527F;
+        this->_h[ 5 ]       = 0x9B05688C;
+        this->_h[ 6 ]       = 0x1F83D9AB;
+        this->_h[ 7 ]       = 0x5BE0CD19;
+        this->_total        = 0;
+        this->_bufferLength = 0;
+    }
+    
+    void swap( SHA256 & v1, SHA256 & v2 ) noexcept
+    {
+        using std::swap;
+        
+        swap( v1._h,            v2._h );
+        swap( v1._total,        v2._total );
+        swap( v1._buffer,       v2._buffer );
+        swap( v1._bufferLength, v2._bufferLength );
+    }
+}
@@ -0,0 +1,158 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        CFPP-StaticString.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    CoreFoundation++ wrapper for constant CFStringRef
+ */
+
+#include <CF++.hpp>
+
+namespace CF
+{
+    CFStringRef StaticString::Create( const char * value )
+    {
+        CFStringRef str;
+        
+        if( value == nullptr )
+        {
+            value = "";
+        }
+        
+        str = CFStringCreateWithCString( static_cast< CFAllocatorRef >( nullptr ), value, kCFStringEncodingUTF8 );
+        
+        if( str == nullptr )
+        {
+            str = CFStringCreateWithCString( static_cast< CFAllocatorRef >( nullptr ), "", kCFStringEncodingUTF8 );
+        }
+        
+        return str;
+    }
+    
+    StaticString StaticString::Constant( CFStringRef value )
+    {
+        StaticString str( static_cast< CFStringRef >( nullptr ) );
+        
+        /*
+         * Constant strings (CFSTR or Create) are never deallocated, so
+         * they're held without any CF call.
+         */
+        str._cfObject = value;
+        
+        return str;
+    }
+    
+    StaticString::StaticString( CFStringRef value ):
+        _cfObject( nullptr ),
+        _retained( false )
+    {
+        /* Any other string is retained for as long as we use it */
+        if( value != nullptr && CFGetTypeID( value ) == this->GetTypeID() )
+        {
+            this->_cfObject = static_cast< CFStringRef >( CFRetain( value ) );
+            this->_retained = true;
+        }
+    }
+    
+    StaticString::StaticString( const StaticString & value ):
+        _cfObject( value._cfObject ),
+        _retained( value._retained )
+    {
+        if( this->_retained )
+        {
+            CFRetain( this->_cfObject );
+        }
+    }
+    
+    StaticString::~StaticString()
+    {
+        if( this->_retained )
+        {
+            CFRelease( this->_cfObject );
+            
+            this->_cfObject = nullptr;
+        }
+    }
+    
+    StaticString & StaticString::operator =( StaticString value )
+    {
+        swap( *( this ), value );
+        
+        return *( this );
+    }
+    
+    bool StaticString::operator == ( const StaticString & value ) const
+    {
+        if( this->_cfObject == nullptr || value._cfObject == nullptr )
+        {
+            return false;
+        }
+        
+        if( this->_cfObject == value._cfObject )
+        {
+            return true;
+        }
+        
+        return ( CFStringCompare( this->_cfObject, value._cfObject, 0 ) == kCFCompareEqualTo ) ? true : false;
+    }
+    
+    bool StaticString::operator != ( const StaticString & value ) const
+    {
+        return !operator ==( value );
+    }
+    
+    CFTypeID StaticString::GetTypeID() const
+    {
+        return CFStringGetTypeID();
+    }
+    
+    CFTypeRef StaticString::GetCFObject() const
+    {
+        return this->_cfObject;
+    }
+    
+    CFIndex StaticString::GetLength() const
+    {
+        if( this->_cfObject == nullptr )
+        {
+            return 0;
+        }
+        
+        return CFStringGetLength( this->_cfObject );
+    }
+    
+    std::string StaticString::GetValue() const
+    {
+        return String( this->_cfObject ).GetValue();
+    }
+    
+    void swap( StaticString & v1, StaticString & v2 ) noexcept
+    {
+        using std::swap;
+        
+        swap( v1._cfObject, v2._cfObject );
+        swap( v1._retained, v2._retained );
+    }
+}
@@ -36,6 +36,7 @@ namespace CF
         _cfObject( nullptr ),
         _length( 0 ),
         _pos( 0 ),
+        _bp( nullptr ),
         _cp( nullptr )
     {}
     
@@ -43,6 +44,7 @@ namespace CF
         _cfObject( value._cfObject ),
         _length( value._length ),
         _pos( value._pos ),
+        _bp( value._bp ),
         _cp( value._cp )
     {
         if( this->_cfObject != nullptr )
@@ -51,28 +53,16 @@ namespace CF
         }
     }
     
-    String::Iterator::Iterator( CFStringRef string, CFStringEncoding encoding, CFIndex length, CFIndex pos ):
+    String::Iterator::Iterator( CFStringRef string, const char * bytes, std::shared_ptr< const std::string > buffer, CFIndex length, CFIndex pos ):
         _cfObject( string ),
         _length( length ),
         _pos( pos ),
-        _cp( nullptr )
+        _bp( bytes ),
+        _cp( buffer )
     {
         if( this->_cfObject != nullptr )
         {
             CFRetain( this->_cfObject );
-            
-            {
-                std::size_t size;
-                
-                size      = static_cast< std::size_t >( CFStringGetMaximumSizeForEncoding( CFStringGetLength( this->_cfObject ), encoding ) );
-                this->_cp = std::shared_ptr< char >( new char[ size + 1 ] );
-                
-                if( this->_cp != nullptr )
-                {
-                    memset( this->_cp.get(), 0, size + 1 );
-                    CFStringGetCString( this->_cfObject, this->_cp.get(), static_cast< CFIndex >( length + 1 ), encoding );
-                }
-            }
         }
     }
     
@@ -84,8 +74,9 @@ namespace CF
         value._length   = 0;
         this->_pos      = value._pos;
         value._pos      = 0;
-        this->_cp       = value._cp;
-        value._cp       = nullptr;
+        this->_bp       = value._bp;
+        value._bp       = nullptr;
+        this->_cp       = std::move( value._cp );
     }
     
     String::Iterator::~Iterator()
@@ -199,7 +190,7 @@ namespace CF
             return 0;
         }
         
-        if( this->_cp == nullptr )
+        if( this->_bp == nullptr )
         {
             return 0;
         }
@@ -214,7 +205,7 @@ namespace CF
             return 0;
         }
         
-        return this->_cp.get()[ this->_pos ];
+        return this->_bp[ this->_pos ];
     }
     
     String::Iterator::operator char () const
@@ -229,6 +220,7 @@ namespace CF
         swap( v1._cfObject, v2._cfObject );
         swap( v1._length,   v2._length );
         swap( v1._pos,      v2._pos );
+        swap( v1._bp,       v2._bp );
         swap( v1._cp,       v2._cp );
     }
 }
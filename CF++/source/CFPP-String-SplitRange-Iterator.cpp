@@ -0,0 +1,184 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        CFPP-String-SplitRange-Iterator.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Iterator class for CF::String::SplitRange
+ */
+
+#include <CF++.hpp>
+
+static CFIndex __FindBytes( const char * bytes, CFIndex length, CFIndex pos, const char * sep, CFIndex sepLength );
+static CFIndex __FindBytes( const char * bytes, CFIndex length, CFIndex pos, const char * sep, CFIndex sepLength )
+{
+    const char * p;
+    const char * last;
+    
+    if( sepLength == 0 || length - pos < sepLength )
+    {
+        return length;
+    }
+    
+    last = bytes + length - sepLength;
+    
+    for( p = bytes + pos; p <= last; p++ )
+    {
+        p = static_cast< const char * >( memchr( p, sep[ 0 ], static_cast< size_t >( last - p ) + 1 ) );
+        
+        if( p == nullptr )
+        {
+            break;
+        }
+        
+        if( sepLength == 1 || memcmp( p + 1, sep + 1, static_cast< size_t >( sepLength - 1 ) ) == 0 )
+        {
+            return static_cast< CFIndex >( p - bytes );
+        }
+    }
+    
+    return length;
+}
+
+namespace CF
+{
+    String::SplitRange::Iterator::Iterator():
+        _state( nullptr ),
+        _pos( 0 ),
+        _next( 0 )
+    {}
+    
+    String::SplitRange::Iterator::Iterator( const Iterator & value ):
+        _state( value._state ),
+        _pos( value._pos ),
+        _next( value._next ),
+        _token( value._token )
+    {}
+    
+    String::SplitRange::Iterator::Iterator( std::shared_ptr< const State > state, CFIndex pos ):
+        _state( state ),
+        _pos( pos ),
+        _next( pos )
+    {
+        this->Next();
+    }
+    
+    String::SplitRange::Iterator::~Iterator()
+    {}
+    
+    String::SplitRange::Iterator & String::SplitRange::Iterator::operator =( Iterator value )
+    {
+        swap( *( this ), value );
+        
+        return *( this );
+    }
+    
+    String::SplitRange::Iterator & String::SplitRange::Iterator::operator ++()
+    {
+        if( this->_state == nullptr || this->_pos > this->_state->_length )
+        {
+            return *( this );
+        }
+        
+        if( this->_next >= this->_state->_length )
+        {
+            this->_pos = this->_state->_length + 1;
+        }
+        else
+        {
+            this->_pos = this->_next + static_cast< CFIndex >( this->_state->_separator.length() );
+        }
+        
+        this->Next();
+        
+        return *( this );
+    }
+    
+    String::SplitRange::Iterator String::SplitRange::Iterator::operator ++( int )
+    {
+        Iterator it( *( this ) );
+        
+        operator++();
+        
+        return it;
+    }
+    
+    bool String::SplitRange::Iterator::operator == ( const Iterator & value ) const
+    {
+        if( this->_state != value._state )
+        {
+            return false;
+        }
+        
+        if( this->_pos != value._pos )
+        {
+            return false;
+        }
+        
+        return true;
+    }
+    
+    bool String::SplitRange::Iterator::operator != ( const Iterator & value ) const
+    {
+        return !( *( this ) == value );
+    }
+    
+    const String::Token & String::SplitRange::Iterator::operator *() const
+    {
+        return this->_token;
+    }
+    
+    const String::Token * String::SplitRange::Iterator::operator ->() const
+    {
+        return &( this->_token );
+    }
+    
+    void String::SplitRange::Iterator::Next()
+    {
+        const State * s;
+        
+        s = this->_state.get();
+        
+        if( s == nullptr || s->_bp == nullptr || this->_pos > s->_length )
+        {
+            this->_next  = this->_pos;
+            this->_token = Token();
+            
+            return;
+        }
+        
+        this->_next  = __FindBytes( s->_bp, s->_length, this->_pos, s->_separator.data(), static_cast< CFIndex >( s->_separator.length() ) );
+        this->_token = Token( s->_bp + this->_pos, this->_next - this->_pos, s->_encoding );
+    }
+    
+    void swap( String::SplitRange::Iterator & v1, String::SplitRange::Iterator & v2 ) noexcept
+    {
+        using std::swap;
+        
+        swap( v1._state, v2._state );
+        swap( v1._pos,   v2._pos );
+        swap( v1._next,  v2._next );
+        swap( v1._token, v2._token );
+    }
+}
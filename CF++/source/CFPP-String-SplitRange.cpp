@@ -0,0 +1,105 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        CFPP-String-SplitRange.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Lazy split range for CF::String
+ */
+
+#include <CF++.hpp>
+
+namespace CF
+{
+    String::SplitRange::State::State( CFStringRef string, const char * bytes, std::shared_ptr< const std::string > buffer, CFIndex length, const std::string & separator, CFStringEncoding encoding ):
+        _cfObject( string ),
+        _bp( bytes ),
+        _cp( buffer ),
+        _length( length ),
+        _separator( separator ),
+        _encoding( encoding )
+    {
+        if( this->_cfObject != nullptr )
+        {
+            CFRetain( this->_cfObject );
+        }
+    }
+    
+    String::SplitRange::State::~State()
+    {
+        if( this->_cfObject != nullptr )
+        {
+            CFRelease( this->_cfObject );
+        }
+    }
+    
+    String::SplitRange::SplitRange( CFStringRef string, const char * bytes, std::shared_ptr< const std::string > buffer, CFIndex length, const std::string & separator, CFStringEncoding encoding ):
+        _state( std::make_shared< const State >( string, bytes, buffer, length, separator, encoding ) )
+    {}
+    
+    String::SplitRange::SplitRange( const SplitRange & value ):
+        _state( value._state )
+    {}
+    
+    String::SplitRange::SplitRange( SplitRange && value ) noexcept:
+        _state( std::move( value._state ) )
+    {}
+    
+    String::SplitRange::~SplitRange()
+    {}
+    
+    String::SplitRange & String::SplitRange::operator =( SplitRange value )
+    {
+        swap( *( this ), value );
+        
+        return *( this );
+    }
+    
+    String::SplitRange::Iterator String::SplitRange::begin() const
+    {
+        if( this->_state == nullptr || this->_state->_bp == nullptr )
+        {
+            return this->end();
+        }
+        
+        return Iterator( this->_state, 0 );
+    }
+    
+    String::SplitRange::Iterator String::SplitRange::end() const
+    {
+        if( this->_state == nullptr )
+        {
+            return Iterator();
+        }
+        
+        return Iterator( this->_state, this->_state->_length + 1 );
+    }
+    
+    void swap( String::SplitRange & v1, String::SplitRange & v2 ) noexcept
+    {
+        using std::swap;
+        
+        swap( v1._state, v2._state );
+    }
+}
@@ -0,0 +1,164 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        CFPP-String-Token.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Token class for CF::String
+ */
+
+#include <CF++.hpp>
+
+namespace CF
+{
+    String::Token::Token():
+        _bp( nullptr ),
+        _length( 0 ),
+        _encoding( kCFStringEncodingUTF8 )
+    {}
+    
+    String::Token::Token( const Token & value ):
+        _bp( value._bp ),
+        _length( value._length ),
+        _encoding( value._encoding )
+    {}
+    
+    String::Token::Token( const char * bytes, CFIndex length, CFStringEncoding encoding ):
+        _bp( bytes ),
+        _length( length ),
+        _encoding( encoding )
+    {}
+    
+    String::Token::~Token()
+    {}
+    
+    String::Token & String::Token::operator =( Token value )
+    {
+        swap( *( this ), value );
+        
+        return *( this );
+    }
+    
+    bool String::Token::operator == ( const Token & value ) const
+    {
+        if( this->_length != value._length )
+        {
+            return false;
+        }
+        
+        return this->_length == 0 || memcmp( this->_bp, value._bp, static_cast< size_t >( this->_length ) ) == 0;
+    }
+    
+    bool String::Token::operator == ( const std::string & value ) const
+    {
+        return operator ==( Token( value.data(), static_cast< CFIndex >( value.length() ), this->_encoding ) );
+    }
+    
+    bool String::Token::operator == ( const char * value ) const
+    {
+        if( value == nullptr )
+        {
+            value = "";
+        }
+        
+        return operator ==( Token( value, static_cast< CFIndex >( strlen( value ) ), this->_encoding ) );
+    }
+    
+    bool String::Token::operator != ( const Token & value ) const
+    {
+        return !operator ==( value );
+    }
+    
+    bool String::Token::operator != ( const std::string & value ) const
+    {
+        return !operator ==( value );
+    }
+    
+    bool String::Token::operator != ( const char * value ) const
+    {
+        return !operator ==( value );
+    }
+    
+    const char * String::Token::GetBytes() const
+    {
+        return this->_bp;
+    }
+    
+    CFIndex String::Token::GetLength() const
+    {
+        return this->_length;
+    }
+    
+    std::string String::Token::GetValue() const
+    {
+        if( this->_bp == nullptr )
+        {
+            return "";
+        }
+        
+        return std::string( this->_bp, static_cast< std::string::size_type >( this->_length ) );
+    }
+    
+    String String::Token::GetString() const
+    {
+        CFStringRef str;
+        String      s;
+        
+        if( this->_bp == nullptr )
+        {
+            return String( static_cast< CFStringRef >( nullptr ) );
+        }
+        
+        str = CFStringCreateWithBytes( static_cast< CFAllocatorRef >( nullptr ), reinterpret_cast< const UInt8 * >( this->_bp ), this->_length, this->_encoding, false );
+        s   = str;
+        
+        if( str != nullptr )
+        {
+            CFRelease( str );
+        }
+        
+        return s;
+    }
+    
+    #if __cplusplus >= 201703L
+    std::string_view String::Token::GetView() const
+    {
+        if( this->_bp == nullptr )
+        {
+            return std::string_view();
+        }
+        
+        return std::string_view( this->_bp, static_cast< std::string_view::size_type >( this->_length ) );
+    }
+    #endif
+    
+    void swap( String::Token & v1, String::Token & v2 ) noexcept
+    {
+        using std::swap;
+        
+        swap( v1._bp,       v2._bp );
+        swap( v1._length,   v2._length );
+        swap( v1._encoding, v2._encoding );
+    }
+}
@@ -29,15 +29,481 @@
  */
 
 #include <CF++.hpp>
+#include <atomic>
+#include <mutex>
+#include <unordered_set>
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+#include <emmintrin.h>
+#define CFPP_STRING_SSE2
+#endif
+
+#if defined( __AVX2__ )
+#include <immintrin.h>
+#define CFPP_STRING_AVX2
+#endif
+
+#define CFPP_STRING_INTERN_SHARDS   16
+#define CFPP_STRING_NOT_INLINE      0xFF
+
+struct __InternHash
+{
+    size_t operator ()( CFStringRef str ) const
+    {
+        return static_cast< size_t >( CFHash( str ) );
+    }
+};
+
+struct __InternEqual
+{
+    bool operator ()( CFStringRef s1, CFStringRef s2 ) const
+    {
+        return ( CFEqual( s1, s2 ) ) ? true : false;
+    }
+};
+
+struct __InternShard
+{
+    std::mutex                                                      mutex;
+    std::unordered_set< CFStringRef, __InternHash, __InternEqual > strings;
+};
+
+static std::atomic< CFIndex > __InternHits( 0 );
+static std::atomic< CFIndex > __InternMisses( 0 );
+
+static __InternShard * __InternTable( void );
+static __InternShard * __InternTable( void )
+{
+    /*
+     * Never destroyed, so interned strings stay valid during static
+     * destruction of other translation units.
+     */
+    static __InternShard * table = new __InternShard[ CFPP_STRING_INTERN_SHARDS ];
+    
+    return table;
+}
+
+static bool __DecodeUTF8( const UInt8 * bytes, size_t length, size_t & i, UInt32 & c );
+static bool __DecodeUTF8( const UInt8 * bytes, size_t length, size_t & i, UInt32 & c )
+{
+    size_t n;
+    UInt32 min;
+    
+    c = bytes[ i ];
+    
+    if( c < 0x80 )
+    {
+        i++;
+        
+        return true;
+    }
+    else if( ( c & 0xE0 ) == 0xC0 )
+    {
+        n   = 1;
+        c  &= 0x1F;
+        min = 0x80;
+    }
+    else if( ( c & 0xF0 ) == 0xE0 )
+    {
+        n   = 2;
+        c  &= 0x0F;
+        min = 0x800;
+    }
+    else if( ( c & 0xF8 ) == 0xF0 )
+    {
+        n   = 3;
+        c  &= 0x07;
+        min = 0x10000;
+    }
+    else
+    {
+        return false;
+    }
+    
+    if( i + n >= length )
+    {
+        return false;
+    }
+    
+    for( size_t j = 1; j <= n; j++ )
+    {
+        if( ( bytes[ i + j ] & 0xC0 ) != 0x80 )
+        {
+            return false;
+        }
+        
+        c = ( c << 6 ) | ( bytes[ i + j ] & 0x3F );
+    }
+    
+    if( c < min || c > 0x10FFFF || ( c >= 0xD800 && c <= 0xDFFF ) )
+    {
+        return false;
+    }
+    
+    i += n + 1;
+    
+    return true;
+}
+
+static CFIndex __UTF16LengthOfUTF8( const UInt8 * bytes, size_t length );
+static CFIndex __UTF16LengthOfUTF8( const UInt8 * bytes, size_t length )
+{
+    size_t  i;
+    UInt32  c;
+    CFIndex n;
+    
+    for( i = 0, n = 0; i < length; )
+    {
+        if( __DecodeUTF8( bytes, length, i, c ) == false )
+        {
+            return -1;
+        }
+        
+        n += ( c > 0xFFFF ) ? 2 : 1;
+    }
+    
+    return n;
+}
+
+static bool __MatchesUTF8( CFStringRef str, CFIndex location, const UInt8 * bytes, size_t length, CFIndex & end );
+static bool __MatchesUTF8( CFStringRef str, CFIndex location, const UInt8 * bytes, size_t length, CFIndex & end )
+{
+    CFIndex              strLength;
+    const char         * cp;
+    const UniChar      * up;
+    CFStringInlineBuffer buffer;
+    size_t               i;
+    UInt32               c;
+    
+    end       = location;
+    strLength = CFStringGetLength( str );
+    
+    if( location < 0 || location > strLength )
+    {
+        return false;
+    }
+    
+    cp = CFStringGetCStringPtr( str, kCFStringEncodingUTF8 );
+    
+    if( cp != nullptr )
+    {
+        if( static_cast< size_t >( strLength - location ) < length || memcmp( cp + location, bytes, length ) != 0 )
+        {
+            return false;
+        }
+        
+        end = location + static_cast< CFIndex >( length );
+        
+        return true;
+    }
+    
+    up = CFStringGetCharactersPtr( str );
+    i  = 0;
+    
+    #ifdef CFPP_STRING_SSE2
+    
+    if( up != nullptr )
+    {
+        __m128i z;
+        __m128i b;
+        __m128i eq;
+        
+        z = _mm_setzero_si128();
+        
+        while( i + 16 <= length && end + 16 <= strLength )
+        {
+            b = _mm_loadu_si128( reinterpret_cast< const __m128i * >( bytes + i ) );
+            
+            if( _mm_movemask_epi8( b ) != 0 )
+            {
+                break;
+            }
+            
+            eq = _mm_and_si128
+            (
+                _mm_cmpeq_epi16( _mm_unpacklo_epi8( b, z ), _mm_loadu_si128( reinterpret_cast< const __m128i * >( up + end ) ) ),
+                _mm_cmpeq_epi16( _mm_unpackhi_epi8( b, z ), _mm_loadu_si128( reinterpret_cast< const __m128i * >( up + end + 8 ) ) )
+            );
+            
+            if( _mm_movemask_epi8( eq ) != 0xFFFF )
+            {
+                return false;
+            }
+            
+            i   += 16;
+            end += 16;
+        }
+    }
+    
+    #else
+    
+    ( void )up;
+    
+    #endif
+    
+    CFStringInitInlineBuffer( str, &buffer, CFRangeMake( 0, strLength ) );
+    
+    while( i < length )
+    {
+        if( __DecodeUTF8( bytes, length, i, c ) == false )
+        {
+            return false;
+        }
+        
+        if( c > 0xFFFF )
+        {
+            c -= 0x10000;
+            
+            if( end + 2 > strLength )
+            {
+                return false;
+            }
+            
+            if( CFStringGetCharacterFromInlineBuffer( &buffer, end )     != static_cast< UniChar >( 0xD800 + ( c >> 10 ) )
+            ||  CFStringGetCharacterFromInlineBuffer( &buffer, end + 1 ) != static_cast< UniChar >( 0xDC00 + ( c & 0x3FF ) ) )
+            {
+                return false;
+            }
+            
+            end += 2;
+        }
+        else
+        {
+            if( end >= strLength || CFStringGetCharacterFromInlineBuffer( &buffer, end ) != static_cast< UniChar >( c ) )
+            {
+                return false;
+            }
+            
+            end++;
+        }
+    }
+    
+    return true;
+}
+
+static bool __EqualsUTF8( CFStringRef str, const UInt8 * bytes, size_t length );
+static bool __EqualsUTF8( CFStringRef str, const UInt8 * bytes, size_t length )
+{
+    CFIndex strLength;
+    CFIndex end;
+    
+    if( str == nullptr )
+    {
+        return false;
+    }
+    
+    strLength = CFStringGetLength( str );
+    
+    if( length < static_cast< size_t >( strLength ) || length > static_cast< size_t >( strLength ) * 3 )
+    {
+        return false;
+    }
+    
+    return __MatchesUTF8( str, 0, bytes, length, end ) && end == strLength;
+}
+
+static bool __HasPrefixUTF8( CFStringRef str, const UInt8 * bytes, size_t length );
+static bool __HasPrefixUTF8( CFStringRef str, const UInt8 * bytes, size_t length )
+{
+    CFIndex end;
+    
+    if( str == nullptr || length == 0 )
+    {
+        return false;
+    }
+    
+    return __MatchesUTF8( str, 0, bytes, length, end );
+}
+
+static bool __HasSuffixUTF8( CFStringRef str, const UInt8 * bytes, size_t length );
+static bool __HasSuffixUTF8( CFStringRef str, const UInt8 * bytes, size_t length )
+{
+    CFIndex strLength;
+    CFIndex n;
+    CFIndex end;
+    
+    if( str == nullptr || length == 0 )
+    {
+        return false;
+    }
+    
+    strLength = CFStringGetLength( str );
+    n         = __UTF16LengthOfUTF8( bytes, length );
+    
+    if( n < 0 || n > strLength )
+    {
+        return false;
+    }
+    
+    return __MatchesUTF8( str, strLength - n, bytes, length, end );
+}
+
+static bool __IsASCII( const UInt8 * bytes, size_t length );
+static bool __IsASCII( const UInt8 * bytes, size_t length )
+{
+    size_t i;
+    UInt64 w;
+    
+    i = 0;
+    
+    /*
+     * NUL bytes are rejected too, as CFStringCreateWithCString would stop
+     * at the first one.
+     */
+    #if defined( CFPP_STRING_AVX2 )
+    
+    {
+        __m256i z;
+        __m256i b;
+        
+        z = _mm256_setzero_si256();
+        
+        for( ; i + 32 <= length; i += 32 )
+        {
+            b = _mm256_loadu_si256( reinterpret_cast< const __m256i * >( bytes + i ) );
+            
+            if( _mm256_movemask_epi8( _mm256_or_si256( b, _mm256_cmpeq_epi8( b, z ) ) ) != 0 )
+            {
+                return false;
+            }
+        }
+    }
+    
+    #endif
+    
+    #if defined( CFPP_STRING_SSE2 )
+    
+    {
+        __m128i z;
+        __m128i b;
+        
+        z = _mm_setzero_si128();
+        
+        for( ; i + 16 <= length; i += 16 )
+        {
+            b = _mm_loadu_si128( reinterpret_cast< const __m128i * >( bytes + i ) );
+            
+            if( _mm_movemask_epi8( _mm_or_si128( b, _mm_cmpeq_epi8( b, z ) ) ) != 0 )
+            {
+                return false;
+            }
+        }
+    }
+    
+    #endif
+    
+    for( ; i + 8 <= length; i += 8 )
+    {
+        memcpy( &w, bytes + i, 8 );
+        
+        if( ( w & 0x8080808080808080ULL ) != 0 || ( ( w - 0x0101010101010101ULL ) & ~w & 0x8080808080808080ULL ) != 0 )
+        {
+            return false;
+        }
+    }
+    
+    for( ; i < length; i++ )
+    {
+        if( bytes[ i ] == 0 || bytes[ i ] >= 0x80 )
+        {
+            return false;
+        }
+    }
+    
+    return true;
+}
+
+static bool __NarrowASCII( const UniChar * chars, size_t length, char * out );
+static bool __NarrowASCII( const UniChar * chars, size_t length, char * out )
+{
+    size_t i;
+    
+    i = 0;
+    
+    #if defined( CFPP_STRING_SSE2 )
+    
+    {
+        __m128i mask;
+        __m128i z;
+        __m128i c1;
+        __m128i c2;
+        
+        mask = _mm_set1_epi16( static_cast< short >( 0xFF80 ) );
+        z    = _mm_setzero_si128();
+        
+        for( ; i + 16 <= length; i += 16 )
+        {
+            c1 = _mm_loadu_si128( reinterpret_cast< const __m128i * >( chars + i ) );
+            c2 = _mm_loadu_si128( reinterpret_cast< const __m128i * >( chars + i + 8 ) );
+            
+            if( _mm_movemask_epi8( _mm_cmpeq_epi16( _mm_and_si128( _mm_or_si128( c1, c2 ), mask ), z ) ) != 0xFFFF )
+            {
+                return false;
+            }
+            
+            _mm_storeu_si128( reinterpret_cast< __m128i * >( out + i ), _mm_packus_epi16( c1, c2 ) );
+        }
+    }
+    
+    #endif
+    
+    for( ; i < length; i++ )
+    {
+        if( chars[ i ] >= 0x80 )
+        {
+            return false;
+        }
+        
+        out[ i ] = static_cast< char >( chars[ i ] );
+    }
+    
+    return true;
+}
 
 namespace CF
 {
-    String::String(): _cfObject( nullptr )
+    struct String::Buffer
+    {
+        CFStringEncoding                     encoding;
+        std::shared_ptr< const std::string > bytes;
+        Buffer                             * next;
+    };
+    
+    /*
+     * Copies of a mutable string share its CFMutableString, and the count
+     * tells whether a mutation can happen in place. A string handed out
+     * through GetCFObject() may be held by CF (e.g. as a dictionary key),
+     * so it's flagged as escaped and never written in place again.
+     */
+    struct String::Share
+    {
+        Share( CFIndex value ):
+            count( value ),
+            escaped( false )
+        {}
+        
+        std::atomic< CFIndex > count;
+        std::atomic< bool >    escaped;
+    };
+    
+    String::String():
+        _cfObject( nullptr ),
+        _buffers( nullptr ),
+        _share( nullptr ),
+        _capacity( 0 ),
+        _inlineLength( CFPP_STRING_NOT_INLINE ),
+        _mutable( false )
     {
         this->SetValue( "" );
     }
     
-    String::String( const AutoPointer & value ): _cfObject( nullptr )
+    String::String( const AutoPointer & value ):
+        _cfObject( nullptr ),
+        _buffers( nullptr ),
+        _share( nullptr ),
+        _capacity( 0 ),
+        _inlineLength( CFPP_STRING_NOT_INLINE ),
+        _mutable( false )
     {
         if( value.IsValid() && value.GetTypeID() == this->GetTypeID() )
         {
@@ -45,7 +511,13 @@ namespace CF
         }
     }
     
-    String::String( CFTypeRef cfObject ): _cfObject( nullptr )
+    String::String( CFTypeRef cfObject ):
+        _cfObject( nullptr ),
+        _buffers( nullptr ),
+        _share( nullptr ),
+        _capacity( 0 ),
+        _inlineLength( CFPP_STRING_NOT_INLINE ),
+        _mutable( false )
     {
         if( cfObject != nullptr && CFGetTypeID( cfObject ) == this->GetTypeID() )
         {
@@ -53,7 +525,13 @@ namespace CF
         }
     }
     
-    String::String( CFStringRef cfObject ): _cfObject( nullptr )
+    String::String( CFStringRef cfObject ):
+        _cfObject( nullptr ),
+        _buffers( nullptr ),
+        _share( nullptr ),
+        _capacity( 0 ),
+        _inlineLength( CFPP_STRING_NOT_INLINE ),
+        _mutable( false )
     {
         if( cfObject != nullptr && CFGetTypeID( cfObject ) == this->GetTypeID() )
         {
@@ -64,7 +542,13 @@ namespace CF
     String::String( std::nullptr_t ): String( static_cast< CFTypeRef >( nullptr ) )
     {}
     
-    String::String( const AutoPointer & value, std::string defaultValueIfNULL, CFStringEncoding encoding ): _cfObject( nullptr )
+    String::String( const AutoPointer & value, std::string defaultValueIfNULL, CFStringEncoding encoding ):
+        _cfObject( nullptr ),
+        _buffers( nullptr ),
+        _share( nullptr ),
+        _capacity( 0 ),
+        _inlineLength( CFPP_STRING_NOT_INLINE ),
+        _mutable( false )
     {
         if( value.IsValid() && value.GetTypeID() == this->GetTypeID() )
         {
@@ -76,7 +560,13 @@ namespace CF
         }
     }
     
-    String::String( CFTypeRef cfObject, std::string defaultValueIfNULL, CFStringEncoding encoding ): _cfObject( nullptr )
+    String::String( CFTypeRef cfObject, std::string defaultValueIfNULL, CFStringEncoding encoding ):
+        _cfObject( nullptr ),
+        _buffers( nullptr ),
+        _share( nullptr ),
+        _capacity( 0 ),
+        _inlineLength( CFPP_STRING_NOT_INLINE ),
+        _mutable( false )
     {
         if( cfObject != nullptr && CFGetTypeID( cfObject ) == this->GetTypeID() )
         {
@@ -88,7 +578,13 @@ namespace CF
         }
     }
     
-    String::String( CFStringRef cfObject, std::string defaultValueIfNULL, CFStringEncoding encoding ): _cfObject( nullptr )
+    String::String( CFStringRef cfObject, std::string defaultValueIfNULL, CFStringEncoding encoding ):
+        _cfObject( nullptr ),
+        _buffers( nullptr ),
+        _share( nullptr ),
+        _capacity( 0 ),
+        _inlineLength( CFPP_STRING_NOT_INLINE ),
+        _mutable( false )
     {
         if( cfObject != nullptr && CFGetTypeID( cfObject ) == this->GetTypeID() )
         {
@@ -100,12 +596,24 @@ namespace CF
         }
     }
     
-    String::String( const std::string & value, CFStringEncoding encoding ): _cfObject( nullptr )
+    String::String( const std::string & value, CFStringEncoding encoding ):
+        _cfObject( nullptr ),
+        _buffers( nullptr ),
+        _share( nullptr ),
+        _capacity( 0 ),
+        _inlineLength( CFPP_STRING_NOT_INLINE ),
+        _mutable( false )
     {
         this->SetValue( value, encoding );
     }
     
-    String::String( char * value, CFStringEncoding encoding ): _cfObject( nullptr )
+    String::String( char * value, CFStringEncoding encoding ):
+        _cfObject( nullptr ),
+        _buffers( nullptr ),
+        _share( nullptr ),
+        _capacity( 0 ),
+        _inlineLength( CFPP_STRING_NOT_INLINE ),
+        _mutable( false )
     {
         if( value == nullptr )
         {
@@ -115,7 +623,13 @@ namespace CF
         this->SetValue( value, encoding );
     }
     
-    String::String( const char * value, CFStringEncoding encoding ): _cfObject( nullptr )
+    String::String( const char * value, CFStringEncoding encoding ):
+        _cfObject( nullptr ),
+        _buffers( nullptr ),
+        _share( nullptr ),
+        _capacity( 0 ),
+        _inlineLength( CFPP_STRING_NOT_INLINE ),
+        _mutable( false )
     {
         if( value == nullptr )
         {
@@ -125,22 +639,64 @@ namespace CF
         this->SetValue( value, encoding );
     }
     
-    String::String( const String & value ): _cfObject( nullptr )
+    String::String( const String & value ):
+        _cfObject( nullptr ),
+        _buffers( nullptr ),
+        _share( nullptr ),
+        _capacity( 0 ),
+        _inlineLength( CFPP_STRING_NOT_INLINE ),
+        _mutable( false )
     {
-        if( value._cfObject != nullptr )
+        Share * share;
+        
+        if( value._cfObject != nullptr && value._mutable )
+        {
+            share = value.AcquireShare();
+            
+            share->count.fetch_add( 1, std::memory_order_relaxed );
+            
+            this->_cfObject = static_cast< CFStringRef >( CFRetain( value._cfObject ) );
+            this->_share    = share;
+            this->_mutable  = true;
+            this->_capacity = value._capacity;
+        }
+        else if( value._cfObject != nullptr )
         {
             this->_cfObject = static_cast< CFStringRef >( CFRetain( ( value._cfObject ) ) );
         }
+        
+        if( value._inlineLength != CFPP_STRING_NOT_INLINE )
+        {
+            memcpy( this->_inline, value._inline, sizeof( this->_inline ) );
+            
+            this->_inlineLength = value._inlineLength;
+        }
+        
     }
     
-    String::String( String && value ) noexcept
+    String::String( String && value ) noexcept:
+        _cfObject( value._cfObject.exchange( nullptr ) ),
+        _buffers( value._buffers.exchange( nullptr ) ),
+        _share( value._share.exchange( nullptr ) ),
+        _capacity( 0 ),
+        _inlineLength( value._inlineLength ),
+        _mutable( value._mutable )
     {
-        this->_cfObject = value._cfObject;
-        value._cfObject = nullptr;
+        /*
+         * Copies either the inline characters or the capacity.
+         */
+        memcpy( this->_inline, value._inline, sizeof( this->_inline ) );
+        
+        value._capacity     = 0;
+        value._inlineLength = CFPP_STRING_NOT_INLINE;
+        value._mutable      = false;
     }
     
     String::~String()
     {
+        this->ClearBuffers();
+        this->ReleaseShare();
+        
         if( this->_cfObject != nullptr )
         {
             CFRelease( this->_cfObject );
@@ -193,11 +749,24 @@ namespace CF
     
     bool String::operator == ( const String & value ) const
     {
+        if( this->_inlineLength != CFPP_STRING_NOT_INLINE && value._inlineLength != CFPP_STRING_NOT_INLINE )
+        {
+            return this->_inlineLength == value._inlineLength && memcmp( this->_inline, value._inline, static_cast< size_t >( this->_inlineLength ) ) == 0;
+        }
+        
+        this->Materialize();
+        value.Materialize();
+        
         if( this->_cfObject == nullptr || value._cfObject == nullptr )
         {
             return false;
         }
         
+        if( this->_cfObject == value._cfObject )
+        {
+            return true;
+        }
+        
         return ( CFStringCompare( this->_cfObject, value._cfObject, 0 ) == kCFCompareEqualTo ) ? true : false;
     }
     
@@ -213,17 +782,32 @@ namespace CF
     
     bool String::operator == ( const std::string & value ) const
     {
-        return operator ==( String( value ) );
+        if( this->_inlineLength != CFPP_STRING_NOT_INLINE )
+        {
+            return value.length() == static_cast< size_t >( this->_inlineLength ) && memcmp( this->_inline, value.data(), value.length() ) == 0;
+        }
+        
+        return __EqualsUTF8( this->_cfObject, reinterpret_cast< const UInt8 * >( value.data() ), value.length() );
     }
     
     bool String::operator == ( char * value ) const
     {
-        return operator ==( String( value ) );
+        return operator ==( static_cast< const char * >( value ) );
     }
     
     bool String::operator == ( const char * value ) const
     {
-        return operator ==( String( value ) );
+        if( value == nullptr )
+        {
+            value = "";
+        }
+        
+        if( this->_inlineLength != CFPP_STRING_NOT_INLINE )
+        {
+            return strlen( value ) == static_cast< size_t >( this->_inlineLength ) && memcmp( this->_inline, value, static_cast< size_t >( this->_inlineLength ) ) == 0;
+        }
+        
+        return __EqualsUTF8( this->_cfObject, reinterpret_cast< const UInt8 * >( value ), strlen( value ) );
     }
             
     bool String::operator != ( const String & value ) const
@@ -258,28 +842,26 @@ namespace CF
             
     String & String::operator += ( const String & value )
     {
-        AutoPointer array;
-        CFStringRef newString;
-        CFStringRef strings[ 2 ];
+        CFMutableStringRef str;
+        
+        value.Materialize();
         
         if( value._cfObject == nullptr )
         {
             return *( this );
         }
         
-        if( this->_cfObject == nullptr )
+        if( &value == this )
         {
-            this->SetValue( "" );
+            return operator +=( String( value ) );
         }
         
-        strings[ 0 ] = this->_cfObject;
-        strings[ 1 ] = value._cfObject;
-        array        = CFArrayCreate( static_cast< CFAllocatorRef >( nullptr ), reinterpret_cast< const void ** >( strings ), 2, nullptr );
-        newString    = CFStringCreateByCombiningStrings( static_cast< CFAllocatorRef >( nullptr ), array.As< CFArrayRef >(), CFSTR( "" ) );
-        
-        CFRelease( this->_cfObject );
+        str = this->GetMutableObject( this->GetLength() + CFStringGetLength( value._cfObject ) );
         
-        this->_cfObject = newString;
+        if( str != nullptr )
+        {
+            CFStringAppend( str, value._cfObject );
+        }
         
         return *( this );
     }
@@ -306,21 +888,27 @@ namespace CF
     
     char String::operator [] ( int index ) const
     {
-        std::string s;
+        const char * s;
+        CFIndex      length;
         
-        s = this->GetValue();
+        s = this->GetEncodedBytes( kCFStringEncodingUTF8, length );
+        
+        if( s == nullptr )
+        {
+            return 0;
+        }
         
         if( index < 0 )
         {
-            index = static_cast< int >( s.length() ) + index;
+            index = static_cast< int >( length ) + index;
         }
         
-        if( static_cast< std::size_t >( index ) >= s.length() )
+        if( index < 0 || index >= length )
         {
             return 0;
         }
         
-        return s.at( static_cast< std::size_t >( index ) );
+        return s[ index ];
     }
     
     String::operator std::string () const
@@ -335,11 +923,21 @@ namespace CF
     
     CFTypeRef String::GetCFObject() const
     {
+        this->Materialize();
+        
+        if( this->_mutable && this->_cfObject != nullptr )
+        {
+            this->AcquireShare()->escaped.store( true, std::memory_order_relaxed );
+        }
+        
         return static_cast< CFTypeRef >( this->_cfObject );
     }
             
     bool String::HasPrefix( const String & value ) const
     {
+        this->Materialize();
+        value.Materialize();
+        
         if( this->_cfObject == nullptr || value._cfObject == nullptr )
         {
             return false;
@@ -359,15 +957,19 @@ namespace CF
     
     bool String::HasPrefix( const std::string & value ) const
     {
-        String s;
-        
-        s = value;
+        if( this->_inlineLength != CFPP_STRING_NOT_INLINE )
+        {
+            return value.length() > 0 && value.length() <= static_cast< size_t >( this->_inlineLength ) && memcmp( this->_inline, value.data(), value.length() ) == 0;
+        }
         
-        return this->HasPrefix( s );
+        return __HasPrefixUTF8( this->_cfObject, reinterpret_cast< const UInt8 * >( value.data() ), value.length() );
     }
     
     bool String::HasSuffix( const String & value ) const
     {
+        this->Materialize();
+        value.Materialize();
+        
         if( this->_cfObject == nullptr || value._cfObject == nullptr )
         {
             return false;
@@ -387,15 +989,21 @@ namespace CF
     
     bool String::HasSuffix( const std::string & value ) const
     {
-        String s;
-        
-        s = value;
+        if( this->_inlineLength != CFPP_STRING_NOT_INLINE )
+        {
+            return value.length() > 0 && value.length() <= static_cast< size_t >( this->_inlineLength ) && memcmp( this->_inline + ( static_cast< size_t >( this->_inlineLength ) - value.length() ), value.data(), value.length() ) == 0;
+        }
         
-        return this->HasSuffix( s );
+        return __HasSuffixUTF8( this->_cfObject, reinterpret_cast< const UInt8 * >( value.data() ), value.length() );
     }
     
     CFIndex String::GetLength() const
     {
+        if( this->_inlineLength != CFPP_STRING_NOT_INLINE )
+        {
+            return this->_inlineLength;
+        }
+        
         if( this->_cfObject == nullptr )
         {
             return 0;
@@ -406,40 +1014,83 @@ namespace CF
     
     std::string String::GetValue( CFStringEncoding encoding ) const
     {
-        const char * s;
-        char       * buf;
-        size_t       length;
-        std::string  str;
+        std::string str;
+        
+        this->GetValue( str, encoding );
+        
+        return str;
+    }
+    
+    void String::GetValue( std::string & value, CFStringEncoding encoding ) const
+    {
+        const char    * s;
+        const UniChar * chars;
+        CFIndex         length;
+        CFIndex         size;
+        
+        value.clear();
+        
+        if( this->_inlineLength != CFPP_STRING_NOT_INLINE && ( encoding == kCFStringEncodingUTF8 || encoding == kCFStringEncodingASCII ) )
+        {
+            value.assign( this->_inline, static_cast< std::string::size_type >( this->_inlineLength ) );
+            
+            return;
+        }
+        
+        this->Materialize();
         
         if( this->_cfObject == nullptr )
         {
-            return "";
+            return;
         }
         
-        s = this->GetCStringValue( encoding );
+        s      = this->GetCStringValue( encoding );
+        length = CFStringGetLength( this->_cfObject );
         
-        if( s == nullptr )
+        if( s != nullptr )
         {
-            length = static_cast< size_t >( CFStringGetMaximumSizeForEncoding( CFStringGetLength( this->_cfObject ), encoding ) );
-            buf    = new char [ length + 1 ];
+            value.assign( s, static_cast< std::string::size_type >( length ) );
             
-            memset( buf, 0, length + 1 );
-            CFStringGetCString( this->_cfObject, buf, static_cast< CFIndex >( length + 1 ), encoding );
-            
-            str = ( buf == nullptr ) ? "" : buf;
+            return;
+        }
+        
+        if( encoding == kCFStringEncodingUTF8 || encoding == kCFStringEncodingASCII )
+        {
+            chars = CFStringGetCharactersPtr( this->_cfObject );
             
-            delete [] buf;
+            if( chars != nullptr )
+            {
+                value.resize( static_cast< std::string::size_type >( length ) );
+                
+                if( length == 0 || __NarrowASCII( chars, static_cast< size_t >( length ), &( value[ 0 ] ) ) )
+                {
+                    return;
+                }
+                
+                value.clear();
+            }
         }
-        else
+        
+        size = 0;
+        
+        if( CFStringGetBytes( this->_cfObject, CFRangeMake( 0, length ), encoding, 0, false, nullptr, 0, &size ) != length || size == 0 )
         {
-            str = s;
+            return;
         }
         
-        return str;
+        value.resize( static_cast< std::string::size_type >( size ) );
+        CFStringGetBytes( this->_cfObject, CFRangeMake( 0, length ), encoding, 0, false, reinterpret_cast< UInt8 * >( &( value[ 0 ] ) ), size, nullptr );
     }
     
     const char * String::GetCStringValue( CFStringEncoding encoding ) const
     {
+        if( this->_inlineLength != CFPP_STRING_NOT_INLINE && ( encoding == kCFStringEncodingUTF8 || encoding == kCFStringEncodingASCII ) )
+        {
+            return this->_inline;
+        }
+        
+        this->Materialize();
+        
         if( this->_cfObject != nullptr )
         {
             return CFStringGetCStringPtr( this->_cfObject, encoding );
@@ -448,30 +1099,421 @@ namespace CF
         return nullptr;
     }
     
+    #if __cplusplus >= 201703L
+    std::string_view String::GetView( CFStringEncoding encoding ) const
+    {
+        const char * s;
+        CFIndex      length;
+        
+        s = this->GetEncodedBytes( encoding, length );
+        
+        if( s == nullptr )
+        {
+            return std::string_view();
+        }
+        
+        return std::string_view( s, static_cast< std::string_view::size_type >( length ) );
+    }
+    #endif
+    
     void String::SetValue( const std::string & value, CFStringEncoding encoding )
     {
+        bool ascii;
+        
         if( this->_cfObject != nullptr )
         {
             CFRelease( this->_cfObject );
         }
         
-        this->_cfObject = CFStringCreateWithCString( static_cast< CFAllocatorRef >( nullptr ), value.c_str(), encoding );
+        this->_cfObject     = nullptr;
+        this->_mutable      = false;
+        this->_capacity     = 0;
+        this->_inlineLength = CFPP_STRING_NOT_INLINE;
+        
+        this->ClearBuffers();
+        this->ReleaseShare();
+        
+        ascii = ( encoding == kCFStringEncodingUTF8 || encoding == kCFStringEncodingASCII ) && __IsASCII( reinterpret_cast< const UInt8 * >( value.data() ), value.length() );
+        
+        if( ascii && value.length() < sizeof( this->_inline ) )
+        {
+            memcpy( this->_inline, value.data(), value.length() );
+            
+            this->_inline[ value.length() ] = 0;
+            this->_inlineLength             = static_cast< UInt8 >( value.length() );
+        }
+        else if( ascii )
+        {
+            this->_cfObject = CFStringCreateWithBytes( static_cast< CFAllocatorRef >( nullptr ), reinterpret_cast< const UInt8 * >( value.data() ), static_cast< CFIndex >( value.length() ), kCFStringEncodingASCII, false );
+        }
+        else
+        {
+            this->_cfObject = CFStringCreateWithCString( static_cast< CFAllocatorRef >( nullptr ), value.c_str(), encoding );
+        }
+    }
+    
+    void String::Reserve( CFIndex capacity )
+    {
+        CFIndex            length;
+        UniChar          * chars;
+        CFMutableStringRef str;
+        
+        this->Materialize();
+        
+        this->_inlineLength = CFPP_STRING_NOT_INLINE;
+        
+        length   = this->GetLength();
+        capacity = std::max( capacity, length );
+        
+        if( capacity == length && this->_mutable == false )
+        {
+            return;
+        }
+        
+        if( this->_mutable && capacity <= this->_capacity && this->IsShared() == false )
+        {
+            return;
+        }
+        
+        /*
+         * CF won't grow an external buffer geometrically on its own, so
+         * appends go through Reserve() to keep them amortized.
+         */
+        chars = static_cast< UniChar * >( CFAllocatorAllocate( static_cast< CFAllocatorRef >( nullptr ), capacity * static_cast< CFIndex >( sizeof( UniChar ) ), 0 ) );
+        
+        if( chars == nullptr )
+        {
+            return;
+        }
+        
+        if( length > 0 )
+        {
+            CFStringGetCharacters( this->_cfObject, CFRangeMake( 0, length ), chars );
+        }
+        
+        str = CFStringCreateMutableWithExternalCharactersNoCopy( static_cast< CFAllocatorRef >( nullptr ), chars, length, capacity, static_cast< CFAllocatorRef >( nullptr ) );
+        
+        if( str == nullptr )
+        {
+            CFAllocatorDeallocate( static_cast< CFAllocatorRef >( nullptr ), chars );
+            
+            return;
+        }
+        
+        if( this->_cfObject != nullptr )
+        {
+            CFRelease( this->_cfObject );
+        }
+        
+        this->ReleaseShare();
+        
+        this->_cfObject = str;
+        this->_mutable  = true;
+        this->_capacity = capacity;
+    }
+    
+    String String::Intern() const
+    {
+        __InternShard * shard;
+        CFStringRef     str;
+        
+        this->Materialize();
+        
+        if( this->_cfObject == nullptr )
+        {
+            return *( this );
+        }
+        
+        shard = __InternTable() + ( CFHash( this->_cfObject ) % CFPP_STRING_INTERN_SHARDS );
+        
+        {
+            std::lock_guard< std::mutex > lock( shard->mutex );
+            
+            auto it = shard->strings.find( this->_cfObject );
+            
+            if( it != shard->strings.end() )
+            {
+                __InternHits++;
+                
+                return String( *( it ) );
+            }
+            
+            str = CFStringCreateCopy( static_cast< CFAllocatorRef >( nullptr ), this->_cfObject );
+            
+            if( str == nullptr )
+            {
+                return *( this );
+            }
+            
+            shard->strings.insert( str );
+            
+            __InternMisses++;
+        }
+        
+        return String( str );
+    }
+    
+    CFIndex String::GetInternHitCount()
+    {
+        return __InternHits.load();
+    }
+    
+    CFIndex String::GetInternMissCount()
+    {
+        return __InternMisses.load();
     }
     
     String::Iterator String::begin( CFStringEncoding encoding ) const
     {
-        return Iterator( this->_cfObject, encoding, this->GetLength() );
+        const char                           * s;
+        CFIndex                                length;
+        std::shared_ptr< const std::string >   bytes;
+        
+        s = this->GetEncodedBytes( encoding, length, &bytes );
+        
+        return Iterator( this->_cfObject, s, bytes, length );
     }
     
     String::Iterator String::end( CFStringEncoding encoding ) const
     {
-        return Iterator( this->_cfObject, encoding, this->GetLength(), this->GetLength() );
+        const char                           * s;
+        CFIndex                                length;
+        std::shared_ptr< const std::string >   bytes;
+        
+        s = this->GetEncodedBytes( encoding, length, &bytes );
+        
+        return Iterator( this->_cfObject, s, bytes, length, length );
+    }
+    
+    String::SplitRange String::Split( const String & separator, CFStringEncoding encoding ) const
+    {
+        const char                           * s;
+        CFIndex                                length;
+        std::string                            sep;
+        std::shared_ptr< const std::string >   bytes;
+        
+        s = this->GetEncodedBytes( encoding, length, &bytes );
+        
+        separator.GetValue( sep, encoding );
+        
+        return SplitRange( this->_cfObject, s, bytes, length, sep, encoding );
     }
     
     void swap( String & v1, String & v2 ) noexcept
     {
         using std::swap;
         
-        swap( v1._cfObject, v2._cfObject );
+        v1._cfObject = v2._cfObject.exchange( v1._cfObject.load() );
+        v1._buffers  = v2._buffers.exchange( v1._buffers.load() );
+        v1._share    = v2._share.exchange( v1._share.load() );
+        
+        swap( v1._inline,       v2._inline );
+        swap( v1._inlineLength, v2._inlineLength );
+        swap( v1._mutable,      v2._mutable );
+    }
+    
+    void String::Materialize() const
+    {
+        CFStringRef str;
+        CFStringRef expected;
+        
+        if( this->_inlineLength == CFPP_STRING_NOT_INLINE || this->_cfObject.load( std::memory_order_acquire ) != nullptr )
+        {
+            return;
+        }
+        
+        /*
+         * Const methods may race to materialize the same inline string.
+         * Only one CFString gets published; the others are released.
+         */
+        str      = CFStringCreateWithBytes( static_cast< CFAllocatorRef >( nullptr ), reinterpret_cast< const UInt8 * >( this->_inline ), this->_inlineLength, kCFStringEncodingASCII, false );
+        expected = nullptr;
+        
+        if( str != nullptr && this->_cfObject.compare_exchange_strong( expected, str, std::memory_order_acq_rel ) == false )
+        {
+            CFRelease( str );
+        }
+    }
+    
+    CFMutableStringRef String::GetMutableObject( CFIndex length )
+    {
+        /* Copies and holders of GetCFObject() keep the value they saw */
+        if( this->_mutable == false || length > this->_capacity || this->IsShared() )
+        {
+            this->Reserve( std::max< CFIndex >( std::max( length, this->GetLength() ) * 2, 32 ) );
+        }
+        
+        if( this->_mutable == false )
+        {
+            return nullptr;
+        }
+        
+        this->ClearBuffers();
+        
+        return static_cast< CFMutableStringRef >( const_cast< void * >( static_cast< const void * >( this->_cfObject ) ) );
+    }
+    
+    String::Share * String::AcquireShare() const
+    {
+        Share * share;
+        Share * expected;
+        
+        /*
+         * Created on first use, and published with a CAS since const copies
+         * may race to create it. The string itself holds the initial count.
+         */
+        share = this->_share.load( std::memory_order_acquire );
+        
+        if( share == nullptr )
+        {
+            share    = new Share( 1 );
+            expected = nullptr;
+            
+            if( this->_share.compare_exchange_strong( expected, share, std::memory_order_acq_rel ) == false )
+            {
+                delete share;
+                
+                share = expected;
+            }
+        }
+        
+        return share;
+    }
+    
+    void String::ReleaseShare() const
+    {
+        Share * share;
+        
+        share = this->_share.exchange( nullptr );
+        
+        if( share != nullptr && share->count.fetch_sub( 1, std::memory_order_acq_rel ) == 1 )
+        {
+            delete share;
+        }
+    }
+    
+    bool String::IsShared() const
+    {
+        Share * share;
+        
+        share = this->_share.load( std::memory_order_acquire );
+        
+        return share != nullptr && ( share->escaped.load( std::memory_order_relaxed ) || share->count.load( std::memory_order_acquire ) > 1 );
+    }
+    
+    String::Buffer * String::FindBuffer( Buffer * first, Buffer * last, CFStringEncoding encoding )
+    {
+        Buffer * buffer;
+        
+        for( buffer = first; buffer != last; buffer = buffer->next )
+        {
+            if( buffer->encoding == encoding )
+            {
+                return buffer;
+            }
+        }
+        
+        return nullptr;
+    }
+    
+    void String::ClearBuffers()
+    {
+        Buffer * buffer;
+        Buffer * next;
+        
+        for( buffer = this->_buffers.exchange( nullptr ); buffer != nullptr; buffer = next )
+        {
+            next = buffer->next;
+            
+            delete buffer;
+        }
+    }
+    
+    const char * String::GetEncodedBytes( CFStringEncoding encoding, CFIndex & length, std::shared_ptr< const std::string > * owner ) const
+    {
+        const char                     * s;
+        Buffer                         * head;
+        Buffer                         * buffer;
+        Buffer                         * found;
+        std::shared_ptr< std::string >   str;
+        
+        length = 0;
+        
+        /*
+         * Iterators and split ranges may outlive this object, so they need
+         * bytes owned by the CFString or a shared buffer.
+         */
+        if( this->_inlineLength != CFPP_STRING_NOT_INLINE && owner == nullptr && ( encoding == kCFStringEncodingUTF8 || encoding == kCFStringEncodingASCII ) )
+        {
+            length = this->_inlineLength;
+            
+            return this->_inline;
+        }
+        
+        this->Materialize();
+        
+        if( this->_cfObject == nullptr )
+        {
+            return nullptr;
+        }
+        
+        s = CFStringGetCStringPtr( this->_cfObject, encoding );
+        
+        /*
+         * CFStringGetCStringPtr only succeeds for strings stored as 8-bit
+         * characters, so there's exactly one byte per character.
+         */
+        if( s != nullptr )
+        {
+            length = CFStringGetLength( this->_cfObject );
+            
+            return s;
+        }
+        
+        /*
+         * One buffer per encoding, kept until the next mutation, so views
+         * returned for one encoding survive requests for another.
+         * Nodes are immutable once published and are pushed with a CAS, so
+         * concurrent const readers never lock nor see a partial node.
+         */
+        head   = this->_buffers.load( std::memory_order_acquire );
+        buffer = FindBuffer( head, nullptr, encoding );
+        
+        if( buffer == nullptr )
+        {
+            str = std::make_shared< std::string >();
+            
+            this->GetValue( *( str ), encoding );
+            
+            buffer           = new Buffer;
+            buffer->encoding = encoding;
+            buffer->bytes    = str;
+            buffer->next     = head;
+            
+            while( this->_buffers.compare_exchange_weak( buffer->next, buffer, std::memory_order_release, std::memory_order_acquire ) == false )
+            {
+                found = FindBuffer( buffer->next, head, encoding );
+                
+                if( found != nullptr )
+                {
+                    delete buffer;
+                    
+                    buffer = found;
+                    
+                    break;
+                }
+                
+                head = buffer->next;
+            }
+        }
+        
+        if( owner != nullptr )
+        {
+            *( owner ) = buffer->bytes;
+        }
+        
+        length = static_cast< CFIndex >( buffer->bytes->length() );
+        
+        return buffer->bytes->data();
     }
 }
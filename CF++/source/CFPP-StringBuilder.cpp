@@ -0,0 +1,433 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        CFPP-StringBuilder.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    CoreFoundation++ builder for CFMutableStringRef
+ */
+
+#include <CF++.hpp>
+
+#define CFPP_STRING_BUILDER_CHUNK   256
+
+static UniChar * __WriteDigits( UniChar * p, unsigned long long value, int width );
+static UniChar * __WriteDigits( UniChar * p, unsigned long long value, int width )
+{
+    UniChar   buf[ 20 ];
+    UniChar * end;
+    int       n;
+    
+    end = buf + 20;
+    n   = 0;
+    
+    do
+    {
+        *( --end ) = static_cast< UniChar >( '0' + ( value % 10 ) );
+        value     /= 10;
+        
+        n++;
+    }
+    while( value != 0 );
+    
+    for( ; n < width; n++ )
+    {
+        *( p++ ) = '0';
+    }
+    
+    while( end < buf + 20 )
+    {
+        *( p++ ) = *( end++ );
+    }
+    
+    return p;
+}
+
+namespace CF
+{
+    StringBuilder::StringBuilder()
+    {}
+    
+    StringBuilder::StringBuilder( CFIndex capacity )
+    {
+        this->Reserve( capacity );
+    }
+    
+    StringBuilder::StringBuilder( const StringBuilder & value ):
+        _string( value._string )
+    {}
+    
+    StringBuilder::StringBuilder( StringBuilder && value ) noexcept:
+        _string( std::move( value._string ) )
+    {}
+    
+    StringBuilder::~StringBuilder()
+    {}
+    
+    StringBuilder & StringBuilder::operator =( StringBuilder value )
+    {
+        swap( *( this ), value );
+        
+        return *( this );
+    }
+    
+    StringBuilder & StringBuilder::operator << ( const String & value )
+    {
+        CFMutableStringRef str;
+        CFStringRef        s;
+        
+        s = static_cast< CFStringRef >( value.GetCFObject() );
+        
+        if( s == nullptr )
+        {
+            return *( this );
+        }
+        
+        str = this->_string.GetMutableObject( this->GetLength() + CFStringGetLength( s ) );
+        
+        if( str != nullptr )
+        {
+            CFStringAppend( str, s );
+        }
+        
+        return *( this );
+    }
+    
+    StringBuilder & StringBuilder::operator << ( CFStringRef value )
+    {
+        return operator <<( String( value ) );
+    }
+    
+    StringBuilder & StringBuilder::operator << ( const std::string & value )
+    {
+        return this->Append( value.data(), value.length() );
+    }
+    
+    StringBuilder & StringBuilder::operator << ( const char * value )
+    {
+        if( value == nullptr )
+        {
+            return *( this );
+        }
+        
+        return this->Append( value, strlen( value ) );
+    }
+    
+    StringBuilder & StringBuilder::operator << ( char value )
+    {
+        return this->Append( &value, 1 );
+    }
+    
+    StringBuilder & StringBuilder::operator << ( bool value )
+    {
+        return ( value ) ? this->Append( "true", 4 ) : this->Append( "false", 5 );
+    }
+    
+    StringBuilder & StringBuilder::operator << ( signed int value )
+    {
+        this->AppendSigned( value );
+        
+        return *( this );
+    }
+    
+    StringBuilder & StringBuilder::operator << ( signed long value )
+    {
+        this->AppendSigned( value );
+        
+        return *( this );
+    }
+    
+    StringBuilder & StringBuilder::operator << ( signed long long value )
+    {
+        this->AppendSigned( value );
+        
+        return *( this );
+    }
+    
+    StringBuilder & StringBuilder::operator << ( unsigned int value )
+    {
+        this->AppendUnsigned( value );
+        
+        return *( this );
+    }
+    
+    StringBuilder & StringBuilder::operator << ( unsigned long value )
+    {
+        this->AppendUnsigned( value );
+        
+        return *( this );
+    }
+    
+    StringBuilder & StringBuilder::operator << ( unsigned long long value )
+    {
+        this->AppendUnsigned( value );
+        
+        return *( this );
+    }
+    
+    StringBuilder & StringBuilder::operator << ( double value )
+    {
+        char buf[ 32 ];
+        int  n;
+        
+        /*
+         * Shortest of %.15g / %.17g that reads back to the same value.
+         */
+        n = snprintf( buf, sizeof( buf ), "%.15g", value );
+        
+        if( n > 0 && strtod( buf, nullptr ) != value && value == value )
+        {
+            n = snprintf( buf, sizeof( buf ), "%.17g", value );
+        }
+        
+        if( n <= 0 )
+        {
+            return *( this );
+        }
+        
+        return this->Append( buf, std::min< size_t >( static_cast< size_t >( n ), sizeof( buf ) - 1 ) );
+    }
+    
+    StringBuilder & StringBuilder::operator << ( const Number & value )
+    {
+        if( value.IsValid() == false )
+        {
+            return *( this );
+        }
+        
+        if( value.IsFloatType() )
+        {
+            return operator <<( value.GetDoubleValue() );
+        }
+        
+        this->AppendSigned( value.GetSignedLongLongValue() );
+        
+        return *( this );
+    }
+    
+    StringBuilder & StringBuilder::operator << ( const Date & value )
+    {
+        UniChar     buf[ 32 ];
+        UniChar   * p;
+        long long   t;
+        long long   days;
+        long long   secs;
+        long long   era;
+        long long   doe;
+        long long   yoe;
+        long long   doy;
+        long long   mp;
+        long long   y;
+        long long   m;
+        long long   d;
+        
+        if( value.IsValid() == false )
+        {
+            return *( this );
+        }
+        
+        /*
+         * UTC, in the same format as XML property lists.
+         * Days are converted with Howard Hinnant's civil_from_days.
+         */
+        t    = static_cast< long long >( value.GetValue() );
+        t    = ( static_cast< CFAbsoluteTime >( t ) > value.GetValue() ) ? t - 1 : t;
+        days = ( t >= 0 ) ? t / 86400 : ( ( t + 1 ) / 86400 ) - 1;
+        secs = t - ( days * 86400 );
+        days = days + 11323 + 719468;
+        era  = ( ( days >= 0 ) ? days : days - 146096 ) / 146097;
+        doe  = days - ( era * 146097 );
+        yoe  = ( doe - ( doe / 1460 ) + ( doe / 36524 ) - ( doe / 146096 ) ) / 365;
+        doy  = doe - ( ( 365 * yoe ) + ( yoe / 4 ) - ( yoe / 100 ) );
+        mp   = ( ( 5 * doy ) + 2 ) / 153;
+        d    = doy - ( ( ( 153 * mp ) + 2 ) / 5 ) + 1;
+        m    = ( mp < 10 ) ? mp + 3 : mp - 9;
+        y    = yoe + ( era * 400 ) + ( ( m <= 2 ) ? 1 : 0 );
+        p    = buf;
+        
+        if( y < 0 )
+        {
+            *( p++ ) = '-';
+            y        = -y;
+        }
+        
+        p        = __WriteDigits( p, static_cast< unsigned long long >( y ), 4 );
+        *( p++ ) = '-';
+        p        = __WriteDigits( p, static_cast< unsigned long long >( m ), 2 );
+        *( p++ ) = '-';
+        p        = __WriteDigits( p, static_cast< unsigned long long >( d ), 2 );
+        *( p++ ) = 'T';
+        p        = __WriteDigits( p, static_cast< unsigned long long >( secs / 3600 ), 2 );
+        *( p++ ) = ':';
+        p        = __WriteDigits( p, static_cast< unsigned long long >( ( secs / 60 ) % 60 ), 2 );
+        *( p++ ) = ':';
+        p        = __WriteDigits( p, static_cast< unsigned long long >( secs % 60 ), 2 );
+        *( p++ ) = 'Z';
+        
+        this->AppendCharacters( buf, static_cast< CFIndex >( p - buf ) );
+        
+        return *( this );
+    }
+    
+    StringBuilder & StringBuilder::Append( const char * value, size_t length )
+    {
+        UniChar            buf[ CFPP_STRING_BUILDER_CHUNK ];
+        size_t             ascii;
+        size_t             i;
+        size_t             n;
+        CFStringRef        s;
+        CFMutableStringRef str;
+        
+        if( value == nullptr )
+        {
+            return *( this );
+        }
+        
+        for( ascii = 0; ascii < length && static_cast< unsigned char >( value[ ascii ] ) < 0x80; ascii++ )
+        {}
+        
+        s = nullptr;
+        
+        /*
+         * The rest is decoded before anything gets appended, so invalid
+         * UTF-8 leaves the builder untouched.
+         */
+        if( ascii < length )
+        {
+            s = CFStringCreateWithBytes( static_cast< CFAllocatorRef >( nullptr ), reinterpret_cast< const UInt8 * >( value + ascii ), static_cast< CFIndex >( length - ascii ), kCFStringEncodingUTF8, false );
+            
+            if( s == nullptr )
+            {
+                return *( this );
+            }
+        }
+        
+        for( i = 0; i < ascii; i += n )
+        {
+            for( n = 0; n < CFPP_STRING_BUILDER_CHUNK && i + n < ascii; n++ )
+            {
+                buf[ n ] = static_cast< UniChar >( value[ i + n ] );
+            }
+            
+            this->AppendCharacters( buf, static_cast< CFIndex >( n ) );
+        }
+        
+        if( s == nullptr )
+        {
+            return *( this );
+        }
+        
+        str = this->_string.GetMutableObject( this->GetLength() + CFStringGetLength( s ) );
+        
+        if( str != nullptr )
+        {
+            CFStringAppend( str, s );
+        }
+        
+        CFRelease( s );
+        
+        return *( this );
+    }
+    
+    CFIndex StringBuilder::GetLength() const
+    {
+        return this->_string.GetLength();
+    }
+    
+    String StringBuilder::GetString() const
+    {
+        return this->_string;
+    }
+    
+    void StringBuilder::Reserve( CFIndex capacity )
+    {
+        this->_string.Reserve( capacity );
+    }
+    
+    void StringBuilder::Clear()
+    {
+        CFMutableStringRef str;
+        
+        str = this->_string.GetMutableObject( 0 );
+        
+        if( str != nullptr )
+        {
+            CFStringDelete( str, CFRangeMake( 0, CFStringGetLength( str ) ) );
+        }
+    }
+    
+    void StringBuilder::AppendCharacters( const UniChar * chars, CFIndex length )
+    {
+        CFMutableStringRef str;
+        
+        if( length <= 0 )
+        {
+            return;
+        }
+        
+        str = this->_string.GetMutableObject( this->GetLength() + length );
+        
+        if( str != nullptr )
+        {
+            CFStringAppendCharacters( str, chars, length );
+        }
+    }
+    
+    void StringBuilder::AppendSigned( signed long long value )
+    {
+        UniChar   buf[ 24 ];
+        UniChar * p;
+        
+        p = buf;
+        
+        if( value < 0 )
+        {
+            *( p++ ) = '-';
+            p        = __WriteDigits( p, 0ULL - static_cast< unsigned long long >( value ), 0 );
+        }
+        else
+        {
+            p = __WriteDigits( p, static_cast< unsigned long long >( value ), 0 );
+        }
+        
+        this->AppendCharacters( buf, static_cast< CFIndex >( p - buf ) );
+    }
+    
+    void StringBuilder::AppendUnsigned( unsigned long long value )
+    {
+        UniChar   buf[ 24 ];
+        UniChar * p;
+        
+        p = __WriteDigits( buf, value, 0 );
+        
+        this->AppendCharacters( buf, static_cast< CFIndex >( p - buf ) );
+    }
+    
+    void swap( StringBuilder & v1, StringBuilder & v2 ) noexcept
+    {
+        using std::swap;
+        
+        swap( v1._string, v2._string );
+    }
+}
@@ -0,0 +1,292 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        CFPP-ThreadPool.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Work-stealing thread pool used by CF::Parallel
+ */
+
+#include <CF++.hpp>
+#include <deque>
+#include <exception>
+
+namespace CF
+{
+    struct ThreadPool::Batch
+    {
+        Batch( const std::function< void( size_t ) > & task, size_t count ):
+            function( task ),
+            remaining( count ),
+            failed( false )
+        {}
+        
+        const std::function< void( size_t ) > & function;
+        size_t                                  remaining;
+        std::atomic< bool >                     failed;
+        std::exception_ptr                      exception;
+        std::mutex                              mutex;
+        std::condition_variable                 condition;
+    };
+    
+    struct ThreadPool::Queue
+    {
+        struct Task
+        {
+            Batch * batch;
+            size_t  index;
+        };
+        
+        std::mutex         mutex;
+        std::deque< Task > tasks;
+    };
+    
+    ThreadPool::ThreadPool(): ThreadPool( std::thread::hardware_concurrency() )
+    {}
+    
+    ThreadPool::ThreadPool( size_t threads ):
+        _pending( 0 ),
+        _next( 0 ),
+        _stop( false )
+    {
+        size_t i;
+        
+        /* The thread calling Run() takes part in the work, so it counts as one of the threads */
+        threads = ( threads == 0 ) ? 1 : threads;
+        
+        for( i = 0; i < threads - 1; i++ )
+        {
+            this->_queues.push_back( std::unique_ptr< Queue >( new Queue ) );
+        }
+        
+        for( i = 0; i < threads - 1; i++ )
+        {
+            this->_threads.push_back( std::thread( &ThreadPool::Work, this, i ) );
+        }
+    }
+    
+    ThreadPool::~ThreadPool()
+    {
+        {
+            std::lock_guard< std::mutex > lock( this->_mutex );
+            
+            this->_stop = true;
+        }
+        
+        this->_condition.notify_all();
+        
+        for( auto & thread: this->_threads )
+        {
+            thread.join();
+        }
+    }
+    
+    ThreadPool & ThreadPool::GetShared()
+    {
+        /* Never destroyed, so no worker is joined during static destruction */
+        static ThreadPool * pool = new ThreadPool();
+        
+        return *( pool );
+    }
+    
+    size_t ThreadPool::GetThreadCount() const
+    {
+        return this->_threads.size() + 1;
+    }
+    
+    void ThreadPool::Run( size_t count, const std::function< void( size_t ) > & task )
+    {
+        size_t i;
+        size_t start;
+        
+        if( count == 0 || !task )
+        {
+            return;
+        }
+        
+        if( this->_queues.empty() || count == 1 )
+        {
+            for( i = 0; i < count; i++ )
+            {
+                task( i );
+            }
+            
+            return;
+        }
+        
+        Batch batch( task, count );
+        
+        {
+            std::lock_guard< std::mutex > lock( this->_mutex );
+            
+            this->_pending += count;
+        }
+        
+        /* Tasks are dealt round-robin; idle workers steal from the others' queues */
+        start = this->_next.fetch_add( 1 );
+        
+        for( i = 0; i < this->_queues.size(); i++ )
+        {
+            Queue                       & queue = *( this->_queues[ ( start + i ) % this->_queues.size() ] );
+            std::lock_guard< std::mutex > lock( queue.mutex );
+            size_t                        j;
+            
+            for( j = i; j < count; j += this->_queues.size() )
+            {
+                queue.tasks.push_back( { &batch, j } );
+            }
+        }
+        
+        this->_condition.notify_all();
+        
+        /* The caller helps until its batch is done, which also keeps nested calls from deadlocking */
+        while( true )
+        {
+            {
+                std::lock_guard< std::mutex > lock( batch.mutex );
+                
+                if( batch.remaining == 0 )
+                {
+                    break;
+                }
+            }
+            
+            if( this->Execute( this->_queues.size() ) == false )
+            {
+                std::unique_lock< std::mutex > lock( batch.mutex );
+                
+                batch.condition.wait( lock, [ & ] { return batch.remaining == 0; } );
+                
+                break;
+            }
+        }
+        
+        /* Written under the batch lock, before the last decrement we waited for */
+        if( batch.exception != nullptr )
+        {
+            std::rethrow_exception( batch.exception );
+        }
+    }
+    
+    void ThreadPool::Work( size_t index )
+    {
+        while( true )
+        {
+            if( this->Execute( index ) )
+            {
+                continue;
+            }
+            
+            std::unique_lock< std::mutex > lock( this->_mutex );
+            
+            this->_condition.wait( lock, [ & ] { return this->_stop || this->_pending > 0; } );
+            
+            if( this->_stop && this->_pending == 0 )
+            {
+                return;
+            }
+        }
+    }
+    
+    bool ThreadPool::Execute( size_t index )
+    {
+        Queue::Task task;
+        bool        found;
+        size_t      i;
+        
+        found = false;
+        
+        /* Own tasks are taken from the back, stolen ones from the front */
+        if( index < this->_queues.size() )
+        {
+            Queue                       & queue = *( this->_queues[ index ] );
+            std::lock_guard< std::mutex > lock( queue.mutex );
+            
+            if( queue.tasks.empty() == false )
+            {
+                task  = queue.tasks.back();
+                found = true;
+                
+                queue.tasks.pop_back();
+                this->_pending--;
+            }
+        }
+        
+        for( i = 0; found == false && i < this->_queues.size(); i++ )
+        {
+            Queue                       & queue = *( this->_queues[ ( index + i + 1 ) % this->_queues.size() ] );
+            std::lock_guard< std::mutex > lock( queue.mutex );
+            
+            if( queue.tasks.empty() == false )
+            {
+                task  = queue.tasks.front();
+                found = true;
+                
+                queue.tasks.pop_front();
+                this->_pending--;
+            }
+        }
+        
+        if( found == false )
+        {
+            return false;
+        }
+        
+        /*
+         * An exception must not escape a worker, so the first one is kept for
+         * Run() to rethrow, and the rest of the batch is drained without
+         * running.
+         */
+        if( task.batch->failed == false )
+        {
+            try
+            {
+                task.batch->function( task.index );
+            }
+            catch( ... )
+            {
+                std::lock_guard< std::mutex > lock( task.batch->mutex );
+                
+                if( task.batch->exception == nullptr )
+                {
+                    task.batch->exception = std::current_exception();
+                }
+                
+                task.batch->failed = true;
+            }
+        }
+        
+        {
+            std::lock_guard< std::mutex > lock( task.batch->mutex );
+            
+            /* Notified under the lock, as Run() may return and destroy the batch as soon as it is released */
+            if( --( task.batch->remaining ) == 0 )
+            {
+                task.batch->condition.notify_all();
+            }
+        }
+        
+        return true;
+    }
+}
@@ -244,6 +244,11 @@ namespace CF
         return this->Write( data.GetBytePtr(), data.GetLength() );
     }
     
+    CFIndex WriteStream::Write( const DataView & data )
+    {
+        return this->Write( data.GetBytePtr(), data.GetLength() );
+    }
+    
     bool WriteStream::WriteAll( const Data::Byte * buffer, CFIndex length )
     {
         CFIndex written;
@@ -290,6 +295,11 @@ namespace CF
         return this->WriteAll( data.GetBytePtr(), data.GetLength() );
     }
     
+    bool WriteStream::WriteAll( const DataView & data )
+    {
+        return this->WriteAll( data.GetBytePtr(), data.GetLength() );
+    }
+    
     AutoPointer WriteStream::GetProperty( const String & name ) const
     {
         if( this->_cfObject == nullptr )
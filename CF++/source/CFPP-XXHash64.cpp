@@ -0,0 +1,275 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+/*!
+ * @file        CFPP-XXHash64.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    CoreFoundation++ incremental XXH64 hash
+ */
+
+#include <CF++.hpp>
+
+#define CFPP_XXHASH64_PRIME1    0x9E3779B185EBCA87ULL
+#define CFPP_XXHASH64_PRIME2    0xC2B2AE3D27D4EB4FULL
+#define CFPP_XXHASH64_PRIME3    0x165667B19E3779F9ULL
+#define CFPP_XXHASH64_PRIME4    0x85EBCA77C2B2AE63ULL
+#define CFPP_XXHASH64_PRIME5    0x27D4EB2F165667C5ULL
+
+static inline UInt64 __RotateLeft( UInt64 value, int bits );
+static inline UInt64 __RotateLeft( UInt64 value, int bits )
+{
+    return ( value << bits ) | ( value >> ( 64 - bits ) );
+}
+
+static inline UInt64 __Read64( const UInt8 * p );
+static inline UInt64 __Read64( const UInt8 * p )
+{
+    UInt64 v;
+    
+    memcpy( &v, p, 8 );
+    
+    return CFSwapInt64LittleToHost( v );
+}
+
+static inline UInt32 __Read32( const UInt8 * p );
+static inline UInt32 __Read32( const UInt8 * p )
+{
+    UInt32 v;
+    
+    memcpy( &v, p, 4 );
+    
+    return CFSwapInt32LittleToHost( v );
+}
+
+static inline UInt64 __Round( UInt64 acc, UInt64 input );
+static inline UInt64 __Round( UInt64 acc, UInt64 input )
+{
+    acc += input * CFPP_XXHASH64_PRIME2;
+    acc  = __RotateLeft( acc, 31 );
+    
+    return acc * CFPP_XXHASH64_PRIME1;
+}
+
+static inline UInt64 __MergeRound( UInt64 acc, UInt64 value );
+static inline UInt64 __MergeRound( UInt64 acc, UInt64 value )
+{
+    acc ^= __Round( 0, value );
+    
+    return acc * CFPP_XXHASH64_PRIME1 + CFPP_XXHASH64_PRIME4;
+}
+
+static const UInt8 * __Consume( UInt64 * v, const UInt8 * p, const UInt8 * end );
+static const UInt8 * __Consume( UInt64 * v, const UInt8 * p, const UInt8 * end )
+{
+    UInt64 v0;
+    UInt64 v1;
+    UInt64 v2;
+    UInt64 v3;
+    
+    v0 = v[ 0 ];
+    v1 = v[ 1 ];
+    v2 = v[ 2 ];
+    v3 = v[ 3 ];
+    
+    /* Four independent lanes, so the multiplies overlap */
+    for( ; p + 32 <= end; p += 32 )
+    {
+        v0 = __Round( v0, __Read64( p ) );
+        v1 = __Round( v1, __Read64( p + 8 ) );
+        v2 = __Round( v2, __Read64( p + 16 ) );
+        v3 = __Round( v3, __Read64( p + 24 ) );
+    }
+    
+    v[ 0 ] = v0;
+    v[ 1 ] = v1;
+    v[ 2 ] = v2;
+    v[ 3 ] = v3;
+    
+    return p;
+}
+
+namespace CF
+{
+    XXHash64::XXHash64(): XXHash64( 0 )
+    {}
+    
+    XXHash64::XXHash64( UInt64 seed ):
+        _seed( seed )
+    {
+        this->Reset();
+    }
+    
+    XXHash64::XXHash64( const XXHash64 & value ):
+        _seed( value._seed ),
+        _total( value._total ),
+        _bufferLength( value._bufferLength )
+    {
+        memcpy( this->_v,      value._v,      sizeof( this->_v ) );
+        memcpy( this->_buffer, value._buffer, sizeof( this->_buffer ) );
+    }
+    
+    XXHash64::XXHash64( XXHash64 && value ) noexcept: XXHash64( static_cast< const XXHash64 & >( value ) )
+    {
+        value.Reset();
+    }
+    
+    XXHash64::~XXHash64()
+    {}
+    
+    XXHash64 & XXHash64::operator =( XXHash64 value )
+    {
+        swap( *( this ), value );
+        
+        return *( this );
+    }
+    
+    XXHash64 & XXHash64::operator << ( const DataView & value )
+    {
+        this->Update( value );
+        
+        return *( this );
+    }
+    
+    void XXHash64::Update( const Data::Byte * bytes, CFIndex length )
+    {
+        const UInt8 * p;
+        const UInt8 * end;
+        size_t        n;
+        
+        if( bytes == nullptr || length <= 0 )
+        {
+            return;
+        }
+        
+        p             = bytes;
+        end           = bytes + length;
+        this->_total += static_cast< UInt64 >( length );
+        
+        if( this->_bufferLength > 0 )
+        {
+            n = std::min( sizeof( this->_buffer ) - this->_bufferLength, static_cast< size_t >( length ) );
+            
+            memcpy( this->_buffer + this->_bufferLength, p, n );
+            
+            this->_bufferLength += n;
+            p                   += n;
+            
+            if( this->_bufferLength < sizeof( this->_buffer ) )
+            {
+                return;
+            }
+            
+            __Consume( this->_v, this->_buffer, this->_buffer + sizeof( this->_buffer ) );
+            
+            this->_bufferLength = 0;
+        }
+        
+        p = __Consume( this->_v, p, end );
+        
+        if( p < end )
+        {
+            memcpy( this->_buffer, p, static_cast< size_t >( end - p ) );
+            
+            this->_bufferLength = static_cast< size_t >( end - p );
+        }
+    }
+    
+    void XXHash64::Update( const DataView & data )
+    {
+        this->Update( data.GetBytePtr(), data.GetLength() );
+    }
+    
+    UInt64 XXHash64::GetValue() const
+    {
+        const UInt8 * p;
+        const UInt8 * end;
+        UInt64        h;
+        
+        if( this->_total >= 32 )
+        {
+            h = __RotateLeft( this->_v[ 0 ], 1 ) + __RotateLeft( this->_v[ 1 ], 7 ) + __RotateLeft( this->_v[ 2 ], 12 ) + __RotateLeft( this->_v[ 3 ], 18 );
+            h = __MergeRound( h, this->_v[ 0 ] );
+            h = __MergeRound( h, this->_v[ 1 ] );
+            h = __MergeRound( h, this->_v[ 2 ] );
+            h = __MergeRound( h, this->_v[ 3 ] );
+        }
+        else
+        {
+            h = this->_seed + CFPP_XXHASH64_PRIME5;
+        }
+        
+        h  += this->_total;
+        p   = this->_buffer;
+        end = this->_buffer + this->_bufferLength;
+        
+        for( ; p + 8 <= end; p += 8 )
+        {
+            h ^= __Round( 0, __Read64( p ) );
+            h  = __RotateLeft( h, 27 ) * CFPP_XXHASH64_PRIME1 + CFPP_XXHASH64_PRIME4;
+        }
+        
+        if( p + 4 <= end )
+        {
+            h ^= static_cast< UInt64 >( __Read32( p ) ) * CFPP_XXHASH64_PRIME1;
+            h  = __RotateLeft( h, 23 ) * CFPP_XXHASH64_PRIME2 + CFPP_XXHASH64_PRIME3;
+            p += 4;
+        }
+        
+        for( ; p < end; p++ )
+        {
+            h ^= *( p ) * CFPP_XXHASH64_PRIME5;
+            h  = __RotateLeft( h, 11 ) * CFPP_XXHASH64_PRIME1;
+        }
+        
+        h ^= h >> 33;
+        h *= CFPP_XXHASH64_PRIME2;
+        h ^= h >> 29;
+        h *= CFPP_XXHASH64_PRIME3;
+        h ^= h >> 32;
+        
+        return h;
+    }
+    
+    void XXHash64::Reset()
+    {
+        this->_v[ 0 ]       = this->_seed + CFPP_XXHASH64_PRIME1 + CFPP_XXHASH64_PRIME2;
+        this->_v[ 1 ]       = this->_seed + CFPP_XXHASH64_PRIME2;
+        this->_v[ 2 ]       = this->_seed;
+        this->_v[ 3 ]       = this->_seed - CFPP_XXHASH64_PRIME1;
+        this->_total        = 0;
+        this->_bufferLength = 0;
+    }
+    
+    void swap( XXHash64 & v1, XXHash64 & v2 ) noexcept
+    {
+        using std::swap;
+        
+        swap( v1._seed,         v2._seed );
+        swap( v1._v,            v2._v );
+        swap( v1._total,        v2._total );
+        swap( v1._buffer,       v2._buffer );
+        swap( v1._bufferLength, v2._bufferLength );
+    }
+}
@@ -139,6 +139,24 @@ TEST( CFPP_AnyPropertyListType, FromPropertyListData )
     }
 }
 
+TEST( CFPP_AnyPropertyListType, FromPropertyListData_DataView )
+{
+    CF::AnyPropertyListType p( CF::PropertyListFormatBinary );
+    CF::Data                data( std::string( "garbage" ) + __plist + "garbage" );
+    
+    p = CF::AnyPropertyListType::FromPropertyListData( CF::DataView( data, CFRangeMake( 7, static_cast< CFIndex >( strlen( __plist ) ) ) ) );
+    
+    ASSERT_TRUE( p.IsValid() );
+    ASSERT_TRUE( p.IsValidPropertyList() );
+    ASSERT_TRUE( p.GetTypeID() == CFDictionaryGetTypeID() );
+    ASSERT_TRUE( p.GetFormat() == CF::PropertyListFormatXML );
+    
+    p = CF::AnyPropertyListType::FromPropertyListData( CF::DataView() );
+    
+    ASSERT_FALSE( p.IsValid() );
+    ASSERT_FALSE( p.IsValidPropertyList() );
+}
+
 TEST( CFPP_AnyPropertyListType, CTOR )
 {
     CF::AnyPropertyListType p( CF::PropertyListFormatBinary );
@@ -29,6 +29,7 @@
  */
 
 #include <CF++.hpp>
+#include <algorithm>
 
 #define XSTEST_GTEST_COMPAT
 #include <XSTest/XSTest.hpp>
@@ -372,6 +373,59 @@ TEST( CFPP_Array_Iterator, OperatorMinus )
     }
 }
 
+TEST( CFPP_Array_Iterator, OperatorDifference )
+{
+    CF::Array a1;
+    CF::Array a2;
+    
+    a2 << CF::String( "hello, world" );
+    a2 << CF::String( "hello, universe" );
+    a2 << CF::String( "foo" );
+    a2 << CF::String( "bar" );
+    
+    ASSERT_EQ( a1.end() - a1.begin(), 0 );
+    ASSERT_EQ( a2.end() - a2.begin(), 4 );
+    ASSERT_EQ( a2.begin() - a2.end(), -4 );
+    ASSERT_EQ( ( a2.begin() + static_cast< CFIndex >( 3 ) ) - ( a2.begin() + static_cast< CFIndex >( 1 ) ), 2 );
+    ASSERT_EQ( std::distance( a2.begin(), a2.end() ), 4 );
+}
+
+TEST( CFPP_Array_Iterator, OperatorPlusReversed )
+{
+    CF::Array a;
+    
+    a << CF::String( "hello, world" );
+    a << CF::String( "hello, universe" );
+    
+    ASSERT_TRUE( static_cast< CFIndex >( 2 ) + a.begin() == a.end() );
+    ASSERT_TRUE( CF::String( *( static_cast< CFIndex >( 1 ) + a.begin() ) ) == "hello, universe" );
+}
+
+TEST( CFPP_Array_Iterator, OperatorSubscript )
+{
+    CF::Array           a;
+    CF::Array::Iterator i;
+    
+    a << CF::String( "hello, world" );
+    a << CF::String( "hello, universe" );
+    a << CF::String( "foo" );
+    
+    ASSERT_TRUE( i[ 0 ] == nullptr );
+    
+    i = a.begin();
+    
+    ASSERT_TRUE( CF::String( i[ 0 ] ) == "hello, world" );
+    ASSERT_TRUE( CF::String( i[ 2 ] ) == "foo" );
+    ASSERT_TRUE( i[ 3 ]  == nullptr );
+    ASSERT_TRUE( i[ -1 ] == nullptr );
+    
+    i = a.end();
+    
+    ASSERT_TRUE( CF::String( i[ -1 ] ) == "foo" );
+    ASSERT_TRUE( CF::String( i[ -3 ] ) == "hello, world" );
+    ASSERT_TRUE( i[ 0 ] == nullptr );
+}
+
 TEST( CFPP_Array_Iterator, OperatorEqual )
 {
     CF::Array a1;
@@ -468,6 +522,54 @@ TEST( CFPP_Array_Iterator, OperatorNotEqual )
     }
 }
 
+TEST( CFPP_Array_Iterator, OperatorLess )
+{
+    CF::Array a;
+    
+    a << CF::String( "hello, world" );
+    a << CF::String( "hello, universe" );
+    
+    ASSERT_TRUE(  ( a.begin() < a.end() ) );
+    ASSERT_FALSE( ( a.end()   < a.begin() ) );
+    ASSERT_FALSE( ( a.begin() < a.begin() ) );
+}
+
+TEST( CFPP_Array_Iterator, OperatorGreater )
+{
+    CF::Array a;
+    
+    a << CF::String( "hello, world" );
+    a << CF::String( "hello, universe" );
+    
+    ASSERT_TRUE(  ( a.end()   > a.begin() ) );
+    ASSERT_FALSE( ( a.begin() > a.end() ) );
+    ASSERT_FALSE( ( a.begin() > a.begin() ) );
+}
+
+TEST( CFPP_Array_Iterator, OperatorLessOrEqual )
+{
+    CF::Array a;
+    
+    a << CF::String( "hello, world" );
+    a << CF::String( "hello, universe" );
+    
+    ASSERT_TRUE(  ( a.begin() <= a.end() ) );
+    ASSERT_TRUE(  ( a.begin() <= a.begin() ) );
+    ASSERT_FALSE( ( a.end()   <= a.begin() ) );
+}
+
+TEST( CFPP_Array_Iterator, OperatorGreaterOrEqual )
+{
+    CF::Array a;
+    
+    a << CF::String( "hello, world" );
+    a << CF::String( "hello, universe" );
+    
+    ASSERT_TRUE(  ( a.end()   >= a.begin() ) );
+    ASSERT_TRUE(  ( a.begin() >= a.begin() ) );
+    ASSERT_FALSE( ( a.begin() >= a.end() ) );
+}
+
 TEST( CFPP_Array_Iterator, OperatorDereference )
 {
     CF::Array a1;
@@ -782,3 +884,81 @@ TEST( CFPP_Array_Iterator, TestIterateCPP11 )
         ASSERT_EQ( i, 4 );
     }
 }
+
+TEST( CFPP_Array_Iterator, TestSnapshot )
+{
+    CF::Array           a;
+    CF::Array::Iterator it;
+    
+    a << CF::String( "hello, world" );
+    a << CF::String( "hello, universe" );
+    
+    it = a.begin();
+    
+    a.RemoveAllValues();
+    a << CF::String( "foo" );
+    
+    ASSERT_EQ( a.GetCount(), 1 );
+    ASSERT_EQ( CF::String( a[ 0 ] ), "foo" );
+    ASSERT_EQ( CF::String( it[ 0 ] ), "hello, world" );
+    ASSERT_EQ( CF::String( it[ 1 ] ), "hello, universe" );
+}
+
+TEST( CFPP_Array_Iterator, TestSnapshotReferencing )
+{
+    CF::Array           a1;
+    CF::Array           a2( CF::Array::Referencing( a1 ) );
+    CF::Array::Iterator it;
+    int                 n( 0 );
+    
+    a2 << CF::String( "hello, world" );
+    a2 << CF::String( "hello, universe" );
+    
+    for( CFTypeRef v: a2 )
+    {
+        ( void )v;
+        
+        n++;
+    }
+    
+    ASSERT_EQ( n, 2 );
+    
+    it = a2.begin();
+    
+    a1.RemoveAllValues();
+    
+    ASSERT_EQ( a2.GetCount(), 0 );
+    ASSERT_EQ( CF::String( it[ 0 ] ), "hello, world" );
+    ASSERT_EQ( CF::String( it[ 1 ] ), "hello, universe" );
+}
+
+TEST( CFPP_Array_Iterator, TestLowerBound )
+{
+    CF::Array           a;
+    CF::Array::Iterator it;
+    
+    a << CF::Number( 1 );
+    a << CF::Number( 3 );
+    a << CF::Number( 5 );
+    a << CF::Number( 7 );
+    
+    auto less = []( CFTypeRef v1, CFTypeRef v2 ) -> bool
+    {
+        return CF::Number( v1 ) < CF::Number( v2 );
+    };
+    
+    ASSERT_TRUE( std::is_sorted( a.begin(), a.end(), less ) );
+    
+    it = std::lower_bound( a.begin(), a.end(), CF::Number( 5 ).GetCFObject(), less );
+    
+    ASSERT_EQ( it - a.begin(), 2 );
+    ASSERT_EQ( CF::Number( *( it ) ), 5 );
+    
+    it = std::lower_bound( a.begin(), a.end(), CF::Number( 4 ).GetCFObject(), less );
+    
+    ASSERT_EQ( it - a.begin(), 2 );
+    
+    it = std::lower_bound( a.begin(), a.end(), CF::Number( 8 ).GetCFObject(), less );
+    
+    ASSERT_TRUE( it == a.end() );
+}
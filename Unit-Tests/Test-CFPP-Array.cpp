@@ -29,10 +29,41 @@
  */
 
 #include <CF++.hpp>
+#include <thread>
+#include <type_traits>
 
 #define XSTEST_GTEST_COMPAT
 #include <XSTest/XSTest.hpp>
 
+/* Input iterator dereferencing to a temporary wrapper */
+struct __StringIterator
+{
+    using iterator_category = std::input_iterator_tag;
+    using value_type        = CF::String;
+    using difference_type   = ptrdiff_t;
+    using pointer           = const CF::String *;
+    using reference         = CF::String;
+    
+    bool operator !=( const __StringIterator & value ) const
+    {
+        return this->i != value.i;
+    }
+    
+    __StringIterator & operator ++()
+    {
+        this->i++;
+        
+        return *( this );
+    }
+    
+    CF::String operator *() const
+    {
+        return CF::String( std::to_string( this->i ) );
+    }
+    
+    int i;
+};
+
 TEST( CFPP_Array, CTOR )
 {
     CF::Array a;
@@ -60,6 +91,20 @@ TEST( CFPP_Array, CTOR_AutoPointer )
     ASSERT_FALSE( a3.IsValid() );
 }
 
+TEST( CFPP_Array, CTOR_AutoPointer_Mutable )
+{
+    CFMutableArrayRef a( CFArrayCreateMutable( nullptr, 0, &kCFTypeArrayCallBacks ) );
+    CF::Array         a1( CF::AutoPointer( CFRetain( a ) ) );
+    
+    ASSERT_NE( a1.GetCFObject(), a );
+    
+    CFArrayAppendValue( a, CF::String( "hello" ) );
+    
+    ASSERT_EQ( a1.GetCount(), 0 );
+    
+    CFRelease( a );
+}
+
 TEST( CFPP_Array, CTOR_CFType )
 {
     CF::Array a1( static_cast< CFTypeRef >( CF::Array().GetCFObject() ) );
@@ -115,6 +160,103 @@ TEST( CFPP_Array, CTOR_STDInitializerList )
     ASSERT_TRUE( CF::String( a[ 3 ] ) == "hello, universe" );
 }
 
+TEST( CFPP_Array, CTOR_CFTypeArray )
+{
+    CF::String s1( "hello" );
+    CF::String s2( "world" );
+    CFTypeRef  v[] = { s1, nullptr, s2 };
+    CF::Array  a1( v, 3 );
+    CF::Array  a2( nullptr, 3 );
+    
+    ASSERT_TRUE( a1.IsValid() );
+    ASSERT_TRUE( a2.IsValid() );
+    ASSERT_EQ( a1.GetCount(), 2 );
+    ASSERT_EQ( a2.GetCount(), 0 );
+    ASSERT_EQ( CF::String( a1[ 0 ] ), "hello" );
+    ASSERT_EQ( CF::String( a1[ 1 ] ), "world" );
+}
+
+TEST( CFPP_Array, CTOR_STDVectorCFType )
+{
+    CF::String               s1( "hello" );
+    CF::String               s2( "world" );
+    std::vector< CFTypeRef > v = { s1, s2 };
+    CF::Array                a( v );
+    
+    ASSERT_TRUE( a.IsValid() );
+    ASSERT_EQ( a.GetCount(), 2 );
+    ASSERT_EQ( CF::String( a[ 1 ] ), "world" );
+}
+
+TEST( CFPP_Array, CTOR_STDVectorString )
+{
+    std::vector< CF::String > v;
+    CF::Array                 a1( v );
+    
+    v.push_back( "hello" );
+    v.push_back( "world" );
+    
+    {
+        CF::Array a2( v );
+        
+        ASSERT_TRUE( a1.IsValid() );
+        ASSERT_EQ( a1.GetCount(), 0 );
+        ASSERT_EQ( a2.GetCount(), 2 );
+        ASSERT_EQ( CF::String( a2[ 0 ] ), "hello" );
+    }
+}
+
+TEST( CFPP_Array, CTOR_Iterators )
+{
+    CF::Array                 a1( { CF::String( "hello" ), CF::Number( 42 ) } );
+    std::vector< CF::Number > v = { CF::Number( 1 ), CF::Number( 2 ), CF::Number( 3 ) };
+    CF::Array                 a2( a1.begin(), a1.end() );
+    CF::Array                 a3( v.begin() + 1, v.end() );
+    
+    ASSERT_EQ( a2.GetCount(), 2 );
+    ASSERT_EQ( CF::Number( a2[ 1 ] ), 42 );
+    ASSERT_EQ( a3.GetCount(), 2 );
+    ASSERT_EQ( CF::Number( a3[ 0 ] ), 2 );
+}
+
+TEST( CFPP_Array, CTOR_Iterators_Temporary )
+{
+    CF::Array a( __StringIterator{ 0 }, __StringIterator{ 3 } );
+    
+    ASSERT_EQ( a.GetCount(), 3 );
+    ASSERT_EQ( CF::String( a[ 0 ] ), "0" );
+    ASSERT_EQ( CF::String( a[ 2 ] ), "2" );
+    
+    a.AppendValues( __StringIterator{ 3 }, __StringIterator{ 5 } );
+    
+    ASSERT_EQ( a.GetCount(), 5 );
+    ASSERT_EQ( CF::String( a[ 4 ] ), "4" );
+}
+
+TEST( CFPP_Array, CTOR_Iterators_CString )
+{
+    using CStrings = std::vector< const char * >;
+    using Strings  = std::vector< CF::String >;
+    
+    ASSERT_FALSE( ( std::is_constructible< CF::Array, CStrings::iterator, CStrings::iterator >::value ) );
+    ASSERT_FALSE( ( std::is_constructible< CF::Array, char **, char ** >::value ) );
+    ASSERT_TRUE(  ( std::is_constructible< CF::Array, Strings::iterator, Strings::iterator >::value ) );
+    ASSERT_TRUE(  ( std::is_constructible< CF::Array, CFTypeRef *, CFTypeRef * >::value ) );
+}
+
+#if __cplusplus >= 202002L
+TEST( CFPP_Array, CTOR_Span )
+{
+    CF::String s1( "hello" );
+    CF::String s2( "world" );
+    CFTypeRef  v[] = { s1, s2 };
+    CF::Array  a( std::span< const CFTypeRef >( v, 2 ) );
+    
+    ASSERT_EQ( a.GetCount(), 2 );
+    ASSERT_EQ( CF::String( a[ 0 ] ), "hello" );
+}
+#endif
+
 TEST( CFPP_Array, CCTOR )
 {
     CF::Array a1;
@@ -135,6 +277,105 @@ TEST( CFPP_Array, CCTOR )
     }
 }
 
+TEST( CFPP_Array, CCTOR_CopyOnWrite )
+{
+    CF::Array a1( { CF::String( "hello" ), CF::String( "world" ) } );
+    CF::Array a2( a1 );
+    CF::Array a3( a1 );
+    
+    ASSERT_EQ( a1.GetCFObject(), a2.GetCFObject() );
+    ASSERT_EQ( a1.GetCFObject(), a3.GetCFObject() );
+    
+    a2 << "!";
+    
+    ASSERT_NE( a1.GetCFObject(), a2.GetCFObject() );
+    ASSERT_EQ( a1.GetCFObject(), a3.GetCFObject() );
+    ASSERT_EQ( a1.GetCount(), 2 );
+    ASSERT_EQ( a2.GetCount(), 3 );
+    
+    a1.ExchangeValuesAtIndices( 0, 1 );
+    
+    ASSERT_EQ( CF::String( a1[ 0 ] ), "world" );
+    ASSERT_EQ( CF::String( a3[ 0 ] ), "hello" );
+    
+    a3.RemoveValueAtIndex( 0 );
+    
+    ASSERT_EQ( a3.GetCount(), 1 );
+    ASSERT_EQ( a1.GetCount(), 2 );
+}
+
+TEST( CFPP_Array, CCTOR_Referencing )
+{
+    CF::Array a1;
+    CF::Array a2 = CF::Array::Referencing( a1 );
+    CF::Array a3( a2 );
+    
+    ASSERT_NE( a2.GetCFObject(), a3.GetCFObject() );
+    
+    a2 << "foo";
+    
+    ASSERT_EQ( a1.GetCount(), 1 );
+    ASSERT_EQ( a3.GetCount(), 0 );
+}
+
+TEST( CFPP_Array, CCTOR_MutableArrayRef )
+{
+    CF::Array         a1( { CF::String( "hello" ), CF::String( "world" ) } );
+    CF::Array         a2( a1 );
+    CF::Type        & t( a1 );
+    CFMutableArrayRef o( static_cast< CFMutableArrayRef >( t ) );
+    CF::Array         a3( a1 );
+    
+    ASSERT_TRUE( o != nullptr );
+    ASSERT_NE( a1.GetCFObject(), a2.GetCFObject() );
+    ASSERT_NE( a1.GetCFObject(), a3.GetCFObject() );
+    
+    CFArrayRemoveValueAtIndex( o, 0 );
+    
+    ASSERT_EQ( a1.GetCount(), 1 );
+    ASSERT_EQ( a2.GetCount(), 2 );
+    ASSERT_EQ( a3.GetCount(), 2 );
+}
+
+TEST( CFPP_Array, CCTOR_Concurrent )
+{
+    const CF::Array            a( { CF::String( "hello" ), CF::String( "world" ) } );
+    std::vector< std::thread > threads;
+    std::atomic< int >         failures( 0 );
+    
+    for( int i = 0; i < 8; i++ )
+    {
+        threads.push_back
+        (
+            std::thread
+            (
+                [ & ]
+                {
+                    for( int j = 0; j < 100; j++ )
+                    {
+                        CF::Array copy( a );
+                        
+                        copy << "!";
+                        
+                        if( copy.GetCount() != 3 )
+                        {
+                            failures++;
+                        }
+                    }
+                }
+            )
+        );
+    }
+    
+    for( auto & t: threads )
+    {
+        t.join();
+    }
+    
+    ASSERT_EQ( failures.load(), 0 );
+    ASSERT_EQ( a.GetCount(), 2 );
+}
+
 TEST( CFPP_Array, MCTOR )
 {
     CF::Array a1;
@@ -405,6 +646,19 @@ TEST( CFPP_Array, OperatorLeftShiftString )
     ASSERT_FALSE( a2.IsValid() );
 }
 
+TEST( CFPP_Array, OperatorLeftShiftStaticString )
+{
+    CF::Array a1;
+    CF::Array a2( static_cast< CFArrayRef >( nullptr ) );
+    
+    a1 << CFPP_STR( "hello, world" );
+    a2 << CFPP_STR( "hello, world" );
+    
+    ASSERT_TRUE(  a1.GetCount() == 1 );
+    ASSERT_FALSE( a2.IsValid() );
+    ASSERT_TRUE(  CF::String( a1[ 0 ] ) == "hello, world" );
+}
+
 TEST( CFPP_Array, OperatorLeftShiftNumber )
 {
     CF::Array a1;
@@ -690,6 +944,26 @@ TEST( CFPP_Array, RemoveValueAtIndex )
     ASSERT_TRUE( a1.GetCount() == 0 );
 }
 
+TEST( CFPP_Array, AppendValues )
+{
+    CF::Array                 a1( { CF::String( "hello" ) } );
+    CF::Array                 a2( a1 );
+    CF::Array                 a3( static_cast< CFArrayRef >( nullptr ) );
+    std::vector< CF::String > v = { "world", "!" };
+    CF::String                s( "foo" );
+    CFTypeRef                 p[] = { s, nullptr };
+    
+    a1.AppendValues( v.begin(), v.end() );
+    a1.AppendValues( p, 2 );
+    a3.AppendValues( p, 2 );
+    
+    ASSERT_EQ( a1.GetCount(), 4 );
+    ASSERT_EQ( a2.GetCount(), 1 );
+    ASSERT_EQ( CF::String( a1[ 1 ] ), "world" );
+    ASSERT_EQ( CF::String( a1[ 3 ] ), "foo" );
+    ASSERT_FALSE( a3.IsValid() );
+}
+
 TEST( CFPP_Array, AppendArray )
 {
     CF::Array a1;
@@ -756,6 +1030,58 @@ TEST( CFPP_Array, ExchangeValuesAtIndices )
     ASSERT_TRUE( CF::String( a1[ 1 ] ) == "hello, world" );
 }
 
+TEST( CFPP_Array, Reserve )
+{
+    CF::Array a( { CF::String( "hello" ) } );
+    CF::Array b( a );
+    CFIndex   i;
+    
+    a.Reserve( 1000 );
+    
+    ASSERT_EQ( a.GetCount(), 1 );
+    ASSERT_EQ( b.GetCount(), 1 );
+    ASSERT_NE( a.GetCFObject(), b.GetCFObject() );
+    ASSERT_EQ( CF::String( a[ 0 ] ), "hello" );
+    
+    for( i = 0; i < 999; i++ )
+    {
+        a << CF::Number( i );
+    }
+    
+    ASSERT_EQ( a.GetCount(), 1000 );
+    ASSERT_EQ( CF::Number( a[ 999 ] ), 998 );
+}
+
+TEST( CFPP_Array, ForEach )
+{
+    CF::Array a1;
+    CF::Array a2( static_cast< CFArrayRef >( nullptr ) );
+    CFIndex   i;
+    
+    a1 << CF::String( "hello, world" );
+    a1 << CF::String( "hello, universe" );
+    
+    i = 0;
+    
+    a2.ForEach( [ & ]( CFTypeRef value ) { ( void )value; i++; } );
+    
+    ASSERT_EQ( i, 0 );
+    
+    a1.ForEach
+    (
+        [ & ]( CFTypeRef value )
+        {
+            ASSERT_TRUE( value == a1.GetValueAtIndex( i ) );
+            
+            i++;
+        }
+    );
+    
+    ASSERT_EQ( i, 2 );
+    
+    a1.ForEach( nullptr );
+}
+
 TEST( CFPP_Array, Swap )
 {
     CF::Array a1;
@@ -0,0 +1,208 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+/*!
+ * @file        Test-CFPP-CRC32C.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Unit tests for CF::CRC32C
+ */
+
+#include <CF++.hpp>
+
+#define XSTEST_GTEST_COMPAT
+#include <XSTest/XSTest.hpp>
+
+TEST( CFPP_CRC32C, CTOR )
+{
+    CF::CRC32C h;
+    
+    ASSERT_EQ( h.GetValue(), 0x00000000U );
+}
+
+TEST( CFPP_CRC32C, CCTOR )
+{
+    CF::CRC32C h1;
+    
+    h1.Update( CF::Data( std::string( "abc" ) ) );
+    
+    {
+        CF::CRC32C h2( h1 );
+        
+        ASSERT_EQ( h2.GetValue(), 0x364B3FB7U );
+    }
+}
+
+TEST( CFPP_CRC32C, MCTOR )
+{
+    CF::CRC32C h1;
+    
+    h1.Update( CF::Data( std::string( "abc" ) ) );
+    
+    {
+        CF::CRC32C h2( std::move( h1 ) );
+        
+        ASSERT_EQ( h2.GetValue(), 0x364B3FB7U );
+        ASSERT_EQ( h1.GetValue(), 0x00000000U );
+    }
+}
+
+TEST( CFPP_CRC32C, OperatorAssign )
+{
+    CF::CRC32C h1;
+    CF::CRC32C h2;
+    
+    h1.Update( CF::Data( std::string( "abc" ) ) );
+    
+    h2 = h1;
+    
+    ASSERT_EQ( h2.GetValue(), 0x364B3FB7U );
+}
+
+TEST( CFPP_CRC32C, OperatorShiftLeft )
+{
+    CF::CRC32C h;
+    
+    h << CF::Data( std::string( "a" ) ) << CF::Data( std::string( "bc" ) );
+    
+    ASSERT_EQ( h.GetValue(), 0x364B3FB7U );
+}
+
+TEST( CFPP_CRC32C, Update )
+{
+    CF::CRC32C h;
+    
+    h.Update( reinterpret_cast< const CF::Data::Byte * >( "123456789" ), 9 );
+    
+    ASSERT_EQ( h.GetValue(), 0xE3069283U );
+    
+    h.Update( nullptr, 10 );
+    
+    ASSERT_EQ( h.GetValue(), 0xE3069283U );
+}
+
+TEST( CFPP_CRC32C, Update_RFC3720 )
+{
+    std::vector< CF::Data::Byte > v( 32, 0x00 );
+    CF::CRC32C                    h;
+    size_t                        i;
+    
+    h << CF::Data( v );
+    
+    ASSERT_EQ( h.GetValue(), 0x8A9136AAU );
+    
+    h.Reset();
+    h << CF::Data( std::vector< CF::Data::Byte >( 32, 0xFF ) );
+    
+    ASSERT_EQ( h.GetValue(), 0x62A8AB43U );
+    
+    for( i = 0; i < v.size(); i++ )
+    {
+        v[ i ] = static_cast< CF::Data::Byte >( i );
+    }
+    
+    h.Reset();
+    h << CF::Data( v );
+    
+    ASSERT_EQ( h.GetValue(), 0x46DD794EU );
+    
+    std::reverse( v.begin(), v.end() );
+    
+    h.Reset();
+    h << CF::Data( v );
+    
+    ASSERT_EQ( h.GetValue(), 0x113FDB5CU );
+}
+
+TEST( CFPP_CRC32C, Update_Incremental )
+{
+    CF::Data   d( std::string( 1000000, 'a' ) );
+    CF::CRC32C h;
+    CFIndex    i;
+    
+    for( i = 0; i < d.GetLength(); i += 37 )
+    {
+        h.Update( CF::DataView( d, CFRangeMake( i, std::min< CFIndex >( 37, d.GetLength() - i ) ) ) );
+    }
+    
+    ASSERT_EQ( h.GetValue(), 0x436FE240U );
+}
+
+TEST( CFPP_CRC32C, Update_Stream )
+{
+    CF::ReadStream s;
+    CF::Data       d;
+    CF::CRC32C     h;
+    
+    s.Open( "/etc/hosts" );
+    
+    d = s.Read();
+    
+    s.Close();
+    s.Open( "/etc/hosts" );
+    
+    for( CF::ReadStream::Iterator it = s.begin( 16 ); it != s.end(); ++it )
+    {
+        h << *( it );
+    }
+    
+    s.Close();
+    
+    ASSERT_GT( d.GetLength(), 0 );
+    ASSERT_EQ( h.GetValue(), d.GetCRC32C() );
+}
+
+TEST( CFPP_CRC32C, GetValue )
+{
+    CF::CRC32C h;
+    
+    h << CF::Data( std::string( "abc" ) );
+    
+    ASSERT_EQ( h.GetValue(), 0x364B3FB7U );
+    ASSERT_EQ( h.GetValue(), 0x364B3FB7U );
+}
+
+TEST( CFPP_CRC32C, Reset )
+{
+    CF::CRC32C h;
+    
+    h << CF::Data( std::string( "abc" ) );
+    
+    h.Reset();
+    
+    ASSERT_EQ( h.GetValue(), 0x00000000U );
+}
+
+TEST( CFPP_CRC32C, Swap )
+{
+    CF::CRC32C h1;
+    CF::CRC32C h2;
+    
+    h1 << CF::Data( std::string( "abc" ) );
+    
+    swap( h1, h2 );
+    
+    ASSERT_EQ( h1.GetValue(), 0x00000000U );
+    ASSERT_EQ( h2.GetValue(), 0x364B3FB7U );
+}
@@ -0,0 +1,187 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+/*!
+ * @file        Test-CFPP-Data-Appender.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Unit tests for CF::Data::Appender
+ */
+
+#include <CF++.hpp>
+
+#define XSTEST_GTEST_COMPAT
+#include <XSTest/XSTest.hpp>
+
+static CF::Data::Byte __bytes[] = { 0xDE, 0xAD, 0xBE, 0xEF };
+
+TEST( CFPP_Data_Appender, CTOR )
+{
+    CF::Data d( { 0xFF } );
+    
+    {
+        CF::Data::Appender a( d );
+        
+        ASSERT_EQ( a.GetLength(), 0 );
+    }
+    
+    ASSERT_EQ( d.GetLength(), 1 );
+    ASSERT_EQ( d[ 0 ], 0xFF );
+}
+
+TEST( CFPP_Data_Appender, CTOR_CFIndex )
+{
+    CF::Data d;
+    
+    {
+        CF::Data::Appender a( d, 1024 );
+        
+        a << 0x01;
+        
+        ASSERT_EQ( a.GetLength(), 1 );
+    }
+    
+    ASSERT_EQ( d.GetLength(), 1 );
+    ASSERT_EQ( d[ 0 ], 0x01 );
+}
+
+TEST( CFPP_Data_Appender, OperatorShiftLeftByte )
+{
+    CF::Data d( { 0xFF } );
+    
+    {
+        CF::Data::Appender a( d );
+        CFIndex            i;
+        
+        for( i = 0; i < 10000; i++ )
+        {
+            a << static_cast< CF::Data::Byte >( i );
+        }
+        
+        ASSERT_EQ( a.GetLength(), 10000 );
+    }
+    
+    ASSERT_EQ( d.GetLength(), 10001 );
+    ASSERT_EQ( d[ 0 ],    0xFF );
+    ASSERT_EQ( d[ 1 ],    0x00 );
+    ASSERT_EQ( d[ 257 ],  0x00 );
+    ASSERT_EQ( d[ 10000 ], static_cast< CF::Data::Byte >( 9999 ) );
+}
+
+TEST( CFPP_Data_Appender, OperatorShiftLeftDataView )
+{
+    CF::Data d;
+    
+    {
+        CF::Data::Appender a( d );
+        
+        a << CF::DataView( __bytes, sizeof( __bytes ) ) << CF::DataView() << CF::DataView( __bytes, 2 );
+    }
+    
+    ASSERT_EQ( d.GetLength(), 6 );
+    ASSERT_EQ( d[ 3 ], 0xEF );
+    ASSERT_EQ( d[ 5 ], 0xAD );
+}
+
+TEST( CFPP_Data_Appender, Append )
+{
+    CF::Data d;
+    
+    {
+        CF::Data::Appender a( d );
+        std::string        s( 1000, 'x' );
+        
+        a.Append( __bytes, sizeof( __bytes ) );
+        a.Append( reinterpret_cast< const CF::Data::Byte * >( s.data() ), static_cast< CFIndex >( s.length() ) );
+        a.Append( nullptr, 10 );
+        
+        ASSERT_EQ( a.GetLength(), 1004 );
+    }
+    
+    ASSERT_EQ( d.GetLength(), 1004 );
+    ASSERT_EQ( d[ 0 ],    0xDE );
+    ASSERT_EQ( d[ 1003 ], 'x' );
+}
+
+TEST( CFPP_Data_Appender, GetLength )
+{
+    CF::Data           d;
+    CF::Data::Appender a( d );
+    
+    ASSERT_EQ( a.GetLength(), 0 );
+    
+    a << 0x01 << 0x02;
+    
+    ASSERT_EQ( a.GetLength(), 2 );
+    
+    a.Commit();
+    
+    ASSERT_EQ( a.GetLength(), 0 );
+}
+
+TEST( CFPP_Data_Appender, Commit )
+{
+    CF::Data d1( __bytes, sizeof( __bytes ) );
+    CF::Data d2( d1 );
+    CF::Data d3( static_cast< CFDataRef >( nullptr ) );
+    
+    {
+        CF::Data::Appender a1( d2 );
+        CF::Data::Appender a2( d3 );
+        
+        a1 << 0x01;
+        a1.Commit();
+        
+        ASSERT_EQ( d2.GetLength(), 5 );
+        ASSERT_EQ( d2[ 4 ], 0x01 );
+        
+        a1 << 0x02;
+        a2 << 0x02;
+    }
+    
+    ASSERT_EQ( d1.GetLength(), 4 );
+    ASSERT_EQ( d2.GetLength(), 6 );
+    ASSERT_EQ( d2[ 5 ], 0x02 );
+    ASSERT_FALSE( d3.IsValid() );
+}
+
+TEST( CFPP_Data_Appender, CopyWhileAppending )
+{
+    CF::Data d1( __bytes, sizeof( __bytes ) );
+    
+    {
+        CF::Data::Appender a( d1 );
+        
+        a << 0x01;
+        
+        CF::Data d2( d1 );
+        
+        a << 0x02;
+        a.Commit();
+        
+        ASSERT_NE( d1.GetCFObject(), d2.GetCFObject() );
+        ASSERT_EQ( d1.GetLength(), 6 );
+        ASSERT_EQ( d1[ 5 ], 0x02 );
+    }
+}
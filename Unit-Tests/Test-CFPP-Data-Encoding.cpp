@@ -0,0 +1,207 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+/*!
+ * @file        Test-CFPP-Data-Encoding.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Unit tests for the CF::Data base64 and hexadecimal codecs
+ */
+
+#include <CF++.hpp>
+
+#define XSTEST_GTEST_COMPAT
+#include <XSTest/XSTest.hpp>
+
+static CF::Data::Byte __bytes[] = { 0xDE, 0xAD, 0xBE, 0xEF };
+
+static CF::Data __Transcode( const CF::Data & data, bool ( * transcode )( CF::ReadStream &, CF::WriteStream & ), bool * result );
+static CF::Data __Transcode( const CF::Data & data, bool ( * transcode )( CF::ReadStream &, CF::WriteStream & ), bool * result )
+{
+    CF::WriteStream out( "/tmp/com.xs-labs.cfpp.encoding.in" );
+    CF::ReadStream  in;
+    CF::Data        d;
+    
+    out.Open();
+    
+    if( data.GetLength() > 0 )
+    {
+        out.WriteAll( data );
+    }
+    
+    out.Close();
+    
+    in.Open( "/tmp/com.xs-labs.cfpp.encoding.in" );
+    out.Open( "/tmp/com.xs-labs.cfpp.encoding.out" );
+    
+    *( result ) = transcode( in, out );
+    
+    in.Close();
+    out.Close();
+    
+    in.Open( "/tmp/com.xs-labs.cfpp.encoding.out" );
+    
+    d = in.Read();
+    
+    in.Close();
+    
+    return d;
+}
+
+TEST( CFPP_Data_Encoding, ToBase64 )
+{
+    ASSERT_EQ( CF::Data( __bytes, sizeof( __bytes ) ).ToBase64(), "3q2+7w==" );
+    ASSERT_EQ( CF::Data( std::string( "hello, world" ) ).ToBase64(), "aGVsbG8sIHdvcmxk" );
+    ASSERT_EQ( CF::Data( std::string( "hello, world!" ) ).ToBase64(), "aGVsbG8sIHdvcmxkIQ==" );
+    ASSERT_EQ( CF::Data( std::string( "The quick brown fox jumps over the lazy dog" ) ).ToBase64(), "VGhlIHF1aWNrIGJyb3duIGZveCBqdW1wcyBvdmVyIHRoZSBsYXp5IGRvZw==" );
+    ASSERT_EQ( CF::Data().ToBase64(), "" );
+    ASSERT_EQ( CF::Data( static_cast< CFDataRef >( nullptr ) ).ToBase64(), "" );
+}
+
+TEST( CFPP_Data_Encoding, FromBase64 )
+{
+    CF::Data d;
+    
+    d = CF::Data::FromBase64( "3q2+7w==" );
+    
+    ASSERT_TRUE( d.IsValid() );
+    ASSERT_EQ( d.GetLength(), 4 );
+    ASSERT_EQ( d[ 0 ], 0xDE );
+    ASSERT_EQ( d[ 3 ], 0xEF );
+    
+    ASSERT_EQ( std::string( CF::Data::FromBase64( "VGhlIHF1aWNrIGJyb3duIGZveCBqdW1wcyBvdmVyIHRoZSBsYXp5IGRvZw==" ) ), "The quick brown fox jumps over the lazy dog" );
+    ASSERT_EQ( std::string( CF::Data::FromBase64( "\n\taGVsbG8s\n\tIHdvcmxk\n\tIQ==\n" ) ), "hello, world!" );
+    ASSERT_EQ( std::string( CF::Data::FromBase64( "aGVsbG8sIHdvcmxkIQ" ) ), "hello, world!" );
+    
+    ASSERT_TRUE( CF::Data::FromBase64( "" ).IsValid() );
+    ASSERT_EQ( CF::Data::FromBase64( "" ).GetLength(), 0 );
+    
+    ASSERT_TRUE(  CF::Data::FromBase64( "3q2+7w=" ).IsValid() );
+    ASSERT_FALSE( CF::Data::FromBase64( "3q2*7w==" ).IsValid() );
+    ASSERT_FALSE( CF::Data::FromBase64( "3q2+7w==3q2+" ).IsValid() );
+    ASSERT_FALSE( CF::Data::FromBase64( "3" ).IsValid() );
+}
+
+TEST( CFPP_Data_Encoding, ToHex )
+{
+    std::string s( 100, '\x5A' );
+    
+    ASSERT_EQ( CF::Data( __bytes, sizeof( __bytes ) ).ToHex(), "deadbeef" );
+    ASSERT_EQ( CF::Data( s ).ToHex().length(), 200 );
+    ASSERT_EQ( CF::Data( s ).ToHex().substr( 190 ), "5a5a5a5a5a" );
+    ASSERT_EQ( CF::Data().ToHex(), "" );
+    ASSERT_EQ( CF::Data( static_cast< CFDataRef >( nullptr ) ).ToHex(), "" );
+}
+
+TEST( CFPP_Data_Encoding, FromHex )
+{
+    CF::Data d;
+    
+    d = CF::Data::FromHex( "DEADbeef" );
+    
+    ASSERT_TRUE( d.IsValid() );
+    ASSERT_EQ( d.GetLength(), 4 );
+    ASSERT_EQ( d[ 0 ], 0xDE );
+    ASSERT_EQ( d[ 3 ], 0xEF );
+    
+    ASSERT_EQ( std::string( CF::Data::FromHex( "68656c6c6f2c20776f726c6421212121212121212121212121" ) ), "hello, world!!!!!!!!!!!!!" );
+    ASSERT_TRUE( CF::Data::FromHex( "" ).IsValid() );
+    ASSERT_FALSE( CF::Data::FromHex( "dead bee" ).IsValid() );
+    ASSERT_FALSE( CF::Data::FromHex( "deadbee" ).IsValid() );
+    ASSERT_FALSE( CF::Data::FromHex( "deadbeeg" ).IsValid() );
+}
+
+TEST( CFPP_Data_Encoding, RoundTrip )
+{
+    CF::Data d;
+    CFIndex  i;
+    
+    for( i = 0; i < 1000; i++ )
+    {
+        d += static_cast< CF::Data::Byte >( i * 7 );
+    }
+    
+    ASSERT_TRUE( CF::Data::FromBase64( d.ToBase64() ) == d );
+    ASSERT_TRUE( CF::Data::FromHex( d.ToHex() ) == d );
+}
+
+TEST( CFPP_Data_Encoding, ToBase64_Stream )
+{
+    std::string s( 100000, 'x' );
+    CF::Data    d;
+    bool        result;
+    
+    d = __Transcode( CF::Data( s ), CF::Data::ToBase64, &result );
+    
+    ASSERT_TRUE( result );
+    ASSERT_EQ( std::string( d ), CF::Data( s ).ToBase64() );
+    
+    d = __Transcode( CF::Data( __bytes, sizeof( __bytes ) ), CF::Data::ToBase64, &result );
+    
+    ASSERT_TRUE( result );
+    ASSERT_EQ( std::string( d ), "3q2+7w==" );
+}
+
+TEST( CFPP_Data_Encoding, FromBase64_Stream )
+{
+    std::string s( 100000, 'x' );
+    CF::Data    d;
+    bool        result;
+    
+    d = __Transcode( CF::Data( CF::Data( s ).ToBase64() ), CF::Data::FromBase64, &result );
+    
+    ASSERT_TRUE( result );
+    ASSERT_EQ( std::string( d ), s );
+    
+    __Transcode( CF::Data( std::string( "3q2*7w==" ) ), CF::Data::FromBase64, &result );
+    
+    ASSERT_FALSE( result );
+}
+
+TEST( CFPP_Data_Encoding, ToHex_Stream )
+{
+    CF::Data d;
+    bool     result;
+    
+    d = __Transcode( CF::Data( __bytes, sizeof( __bytes ) ), CF::Data::ToHex, &result );
+    
+    ASSERT_TRUE( result );
+    ASSERT_EQ( std::string( d ), "deadbeef" );
+}
+
+TEST( CFPP_Data_Encoding, FromHex_Stream )
+{
+    CF::Data d;
+    bool     result;
+    
+    d = __Transcode( CF::Data( std::string( "deadbeef" ) ), CF::Data::FromHex, &result );
+    
+    ASSERT_TRUE( result );
+    ASSERT_EQ( d.GetLength(), 4 );
+    ASSERT_EQ( d[ 0 ], 0xDE );
+    
+    __Transcode( CF::Data( std::string( "deadbee" ) ), CF::Data::FromHex, &result );
+    
+    ASSERT_FALSE( result );
+}
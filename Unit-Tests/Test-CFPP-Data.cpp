@@ -29,6 +29,7 @@
  */
 
 #include <CF++.hpp>
+#include <thread>
 
 #define XSTEST_GTEST_COMPAT
 #include <XSTest/XSTest.hpp>
@@ -53,13 +54,22 @@ TEST( CFPP_Data, CTOR_CFIndex )
 
 TEST( CFPP_Data, CTOR_AutoPointer )
 {
-    CF::Data d1( CF::AutoPointer( CFDataCreateMutable( nullptr, 10 ) ) );
-    CF::Data d2( CF::AutoPointer( CFUUIDCreate( nullptr ) ) );
-    CF::Data d3( CF::AutoPointer( nullptr ) );
+    CF::Data        d1( CF::AutoPointer( CFDataCreateMutable( nullptr, 10 ) ) );
+    CF::Data        d2( CF::AutoPointer( CFUUIDCreate( nullptr ) ) );
+    CF::Data        d3( CF::AutoPointer( nullptr ) );
+    CF::AutoPointer p( CFDataCreate( nullptr, __bytes, sizeof( __bytes ) ) );
+    CF::Data        d4( p );
     
     ASSERT_TRUE(  d1.IsValid() );
     ASSERT_FALSE( d2.IsValid() );
     ASSERT_FALSE( d3.IsValid() );
+    ASSERT_TRUE(  d4.IsValid() );
+    ASSERT_NE( d4.GetCFObject(), p.GetCFObject() );
+    
+    d4 += 42;
+    
+    ASSERT_EQ( d4.GetLength(), static_cast< CFIndex >( sizeof( __bytes ) ) + 1 );
+    ASSERT_EQ( CFDataGetLength( static_cast< CFDataRef >( p.GetCFObject() ) ), static_cast< CFIndex >( sizeof( __bytes ) ) );
 }
 
 TEST( CFPP_Data, CTOR_CFType )
@@ -146,6 +156,42 @@ TEST( CFPP_Data, CTOR_STDVector )
     ASSERT_TRUE( d[ 3 ] == 0xEF );
 }
 
+TEST( CFPP_Data, CTOR_STDStringMove )
+{
+    std::string             s( 4096, 'a' );
+    const CF::Data::Byte  * p( reinterpret_cast< const CF::Data::Byte * >( s.data() ) );
+    CF::Data                d1( std::move( s ) );
+    CF::Data                d2( std::string( "" ) );
+    
+    ASSERT_TRUE( d1.IsValid() );
+    ASSERT_TRUE( d2.IsValid() );
+    ASSERT_EQ( d1.GetLength(), 4096 );
+    ASSERT_EQ( d2.GetLength(), 0 );
+    ASSERT_TRUE( d1.GetBytePtr() == p );
+    
+    d1 += 'b';
+    
+    ASSERT_EQ( d1.GetLength(), 4097 );
+    ASSERT_EQ( d1[ 4096 ], 'b' );
+}
+
+TEST( CFPP_Data, CTOR_STDVectorMove )
+{
+    std::vector< CF::Data::Byte > v( 4096, 0x42 );
+    const CF::Data::Byte        * p( v.data() );
+    CF::Data                      d( std::move( v ) );
+    
+    ASSERT_TRUE( d.IsValid() );
+    ASSERT_EQ( d.GetLength(), 4096 );
+    ASSERT_TRUE( d.GetBytePtr() == p );
+    
+    d.GetMutableBytePtr()[ 0 ] = 0;
+    
+    ASSERT_TRUE( d.GetBytePtr() != p );
+    ASSERT_EQ( d[ 0 ], 0 );
+    ASSERT_EQ( d[ 1 ], 0x42 );
+}
+
 TEST( CFPP_Data, CCTOR )
 {
     CF::Data d1;
@@ -159,6 +205,118 @@ TEST( CFPP_Data, CCTOR )
     ASSERT_FALSE( d4.IsValid() );
 }
 
+TEST( CFPP_Data, CCTOR_CopyOnWrite )
+{
+    CF::Data d1( __bytes, sizeof( __bytes ) );
+    CF::Data d2( d1 );
+    CF::Data d3( d1 );
+    
+    ASSERT_EQ( d1.GetCFObject(), d2.GetCFObject() );
+    ASSERT_EQ( d1.GetCFObject(), d3.GetCFObject() );
+    
+    d2 += 42;
+    
+    ASSERT_NE( d1.GetCFObject(), d2.GetCFObject() );
+    ASSERT_EQ( d1.GetCFObject(), d3.GetCFObject() );
+    ASSERT_EQ( d1.GetLength(), static_cast< CFIndex >( sizeof( __bytes ) ) );
+    ASSERT_EQ( d2.GetLength(), static_cast< CFIndex >( sizeof( __bytes ) ) + 1 );
+    
+    d1.GetMutableBytePtr()[ 0 ] = 0xFF;
+    
+    ASSERT_EQ( d1[ 0 ], 0xFF );
+    ASSERT_EQ( d3[ 0 ], __bytes[ 0 ] );
+    
+    d3.DeleteBytes( CFRangeMake( 0, 1 ) );
+    
+    ASSERT_EQ( d3.GetLength(), static_cast< CFIndex >( sizeof( __bytes ) ) - 1 );
+}
+
+TEST( CFPP_Data, CCTOR_Referencing )
+{
+    CF::Data d1;
+    CF::Data d2 = CF::Data::Referencing( d1 );
+    CF::Data d3( d2 );
+    
+    ASSERT_NE( d2.GetCFObject(), d3.GetCFObject() );
+    
+    d2 += 42;
+    
+    ASSERT_EQ( d1.GetLength(), 1 );
+    ASSERT_EQ( d3.GetLength(), 0 );
+}
+
+TEST( CFPP_Data, CCTOR_MutableBytePtr )
+{
+    CF::Data         d1( __bytes, sizeof( __bytes ) );
+    CF::Data::Byte * p( d1.GetMutableBytePtr() );
+    CF::Data         d2( d1 );
+    
+    ASSERT_NE( d1.GetCFObject(), d2.GetCFObject() );
+    
+    p[ 0 ] = 0xFF;
+    
+    ASSERT_EQ( d1[ 0 ], 0xFF );
+    ASSERT_EQ( d2[ 0 ], __bytes[ 0 ] );
+}
+
+TEST( CFPP_Data, CCTOR_MutableDataRef )
+{
+    CF::Data         d1( __bytes, sizeof( __bytes ) );
+    CF::Data         d2( d1 );
+    CF::Type       & t( d1 );
+    CFMutableDataRef o( static_cast< CFMutableDataRef >( t ) );
+    CF::Data         d3( d1 );
+    
+    ASSERT_TRUE( o != nullptr );
+    ASSERT_NE( d1.GetCFObject(), d2.GetCFObject() );
+    ASSERT_NE( d1.GetCFObject(), d3.GetCFObject() );
+    
+    CFDataGetMutableBytePtr( o )[ 0 ] = 0xFF;
+    
+    ASSERT_EQ( d1[ 0 ], 0xFF );
+    ASSERT_EQ( d2[ 0 ], __bytes[ 0 ] );
+    ASSERT_EQ( d3[ 0 ], __bytes[ 0 ] );
+}
+
+TEST( CFPP_Data, CCTOR_Concurrent )
+{
+    const CF::Data             d( __bytes, sizeof( __bytes ) );
+    std::vector< std::thread > threads;
+    std::atomic< int >         failures( 0 );
+    
+    for( int i = 0; i < 8; i++ )
+    {
+        threads.push_back
+        (
+            std::thread
+            (
+                [ & ]
+                {
+                    for( int j = 0; j < 100; j++ )
+                    {
+                        CF::Data copy( d );
+                        
+                        copy += 42;
+                        
+                        if( copy.GetLength() != static_cast< CFIndex >( sizeof( __bytes ) ) + 1 )
+                        {
+                            failures++;
+                        }
+                    }
+                }
+            )
+        );
+    }
+    
+    for( auto & t: threads )
+    {
+        t.join();
+    }
+    
+    ASSERT_EQ( failures.load(), 0 );
+    ASSERT_EQ( d.GetLength(), static_cast< CFIndex >( sizeof( __bytes ) ) );
+}
+
 TEST( CFPP_Data, MCTOR )
 {
     CF::Data d1;
@@ -332,6 +490,93 @@ TEST( CFPP_Data, OperatorAssignSTDVector )
     ASSERT_TRUE( d1[ 3 ] == 0xEF );
 }
 
+TEST( CFPP_Data, NoCopy )
+{
+    CF::Data::Byte * p;
+    
+    p = static_cast< CF::Data::Byte * >( CFAllocatorAllocate( static_cast< CFAllocatorRef >( nullptr ), sizeof( __bytes ), 0 ) );
+    
+    memcpy( p, __bytes, sizeof( __bytes ) );
+    
+    {
+        CF::Data d( CF::Data::NoCopy( p, sizeof( __bytes ), static_cast< CFAllocatorRef >( nullptr ) ) );
+        
+        ASSERT_TRUE( d.IsValid() );
+        ASSERT_TRUE( d.GetBytePtr() == p );
+        ASSERT_EQ( d[ 3 ], 0xEF );
+    }
+    
+    ASSERT_FALSE( CF::Data::NoCopy( nullptr, 0, static_cast< CFAllocatorRef >( nullptr ) ).IsValid() );
+}
+
+TEST( CFPP_Data, NoCopy_Deallocator )
+{
+    const CF::Data::Byte * released( nullptr );
+    
+    {
+        CF::Data d( CF::Data::NoCopy( __bytes, sizeof( __bytes ), [ & ]( const CF::Data::Byte * p ) { released = p; } ) );
+        
+        ASSERT_TRUE( d.IsValid() );
+        ASSERT_TRUE( d.GetBytePtr() == __bytes );
+        ASSERT_EQ( d.GetLength(), static_cast< CFIndex >( sizeof( __bytes ) ) );
+        ASSERT_TRUE( released == nullptr );
+        
+        d += 42;
+        
+        ASSERT_TRUE( d.GetBytePtr() != __bytes );
+        ASSERT_EQ( __bytes[ 0 ], 0xDE );
+    }
+    
+    ASSERT_TRUE( released == __bytes );
+}
+
+TEST( CFPP_Data, MapFile )
+{
+    FILE * fp;
+    
+    fp = fopen( "/tmp/com.xs-labs.cfpp.data", "wb" );
+    
+    ASSERT_TRUE( fp != nullptr );
+    ASSERT_EQ( fwrite( __bytes, 1, sizeof( __bytes ), fp ), sizeof( __bytes ) );
+    
+    fclose( fp );
+    
+    {
+        CF::Data d1( CF::Data::MapFile( "/tmp/com.xs-labs.cfpp.data" ) );
+        CF::Data d2( CF::Data::MapFile( "/tmp/com.xs-labs.cfpp.data", CF::Data::MapOptionSequential | CF::Data::MapOptionWillNeed | CF::Data::MapOptionPrefault ) );
+        
+        ASSERT_TRUE( d1.IsValid() );
+        ASSERT_TRUE( d2.IsValid() );
+        ASSERT_EQ( d1.GetLength(), static_cast< CFIndex >( sizeof( __bytes ) ) );
+        ASSERT_EQ( d2.GetLength(), static_cast< CFIndex >( sizeof( __bytes ) ) );
+        ASSERT_EQ( memcmp( d1.GetBytePtr(), __bytes, sizeof( __bytes ) ), 0 );
+        ASSERT_EQ( memcmp( d2.GetBytePtr(), __bytes, sizeof( __bytes ) ), 0 );
+        
+        d1 += 42;
+        
+        ASSERT_EQ( d1.GetLength(), static_cast< CFIndex >( sizeof( __bytes ) ) + 1 );
+        ASSERT_EQ( d1[ 4 ], 42 );
+        ASSERT_EQ( d2.GetLength(), static_cast< CFIndex >( sizeof( __bytes ) ) );
+    }
+    
+    fp = fopen( "/tmp/com.xs-labs.cfpp.data", "wb" );
+    
+    ASSERT_TRUE( fp != nullptr );
+    
+    fclose( fp );
+    
+    {
+        CF::Data d( CF::Data::MapFile( "/tmp/com.xs-labs.cfpp.data" ) );
+        
+        ASSERT_TRUE( d.IsValid() );
+        ASSERT_EQ( d.GetLength(), 0 );
+    }
+    
+    remove( "/tmp/com.xs-labs.cfpp.data" );
+    
+    ASSERT_FALSE( CF::Data::MapFile( "/tmp/com.xs-labs.cfpp.data" ).IsValid() );
+}
+
 TEST( CFPP_Data, Referencing )
 {
     CF::Data d1;
@@ -546,6 +791,19 @@ TEST( CFPP_Data, OperatorPlusEqualSTDVector )
     ASSERT_TRUE( d2[ 0 ] == 0xFF );
 }
 
+TEST( CFPP_Data, OperatorPlusEqualDataView )
+{
+    CF::Data d( { 0xFF } );
+    
+    d += CF::DataView( __bytes, sizeof( __bytes ) ).Slice( 2 );
+    d += CF::DataView();
+    
+    ASSERT_EQ( d.GetLength(), 3 );
+    ASSERT_TRUE( d[ 0 ] == 0xFF );
+    ASSERT_TRUE( d[ 1 ] == 0xBE );
+    ASSERT_TRUE( d[ 2 ] == 0xEF );
+}
+
 TEST( CFPP_Data, GetTypeID )
 {
     CF::Data d;
@@ -726,6 +984,26 @@ TEST( CFPP_Data, AppendBytes )
     ASSERT_TRUE( d2.GetBytePtr()[ 7 ] == 0xEF );
 }
 
+TEST( CFPP_Data, AppendBytes_DataView )
+{
+    CF::Data d1( __bytes, sizeof( __bytes ) );
+    CF::Data d2( static_cast< CFDataRef >( nullptr ) );
+    
+    d1.AppendBytes( CF::DataView( __bytes, sizeof( __bytes ) ).Slice( CFRangeMake( 1, 2 ) ) );
+    d2.AppendBytes( CF::DataView( __bytes, sizeof( __bytes ) ) );
+    
+    ASSERT_EQ( d1.GetLength(), 6 );
+    ASSERT_FALSE( d2.IsValid() );
+    ASSERT_TRUE( d1[ 4 ] == 0xAD );
+    ASSERT_TRUE( d1[ 5 ] == 0xBE );
+    
+    d1.AppendBytes( CF::DataView( d1 ) );
+    
+    ASSERT_EQ( d1.GetLength(), 12 );
+    ASSERT_TRUE( d1[ 6 ]  == 0xDE );
+    ASSERT_TRUE( d1[ 11 ] == 0xBE );
+}
+
 TEST( CFPP_Data, ReplaceBytes )
 {
     CF::Data       d1( __bytes, sizeof( __bytes ) );
@@ -784,6 +1062,48 @@ TEST( CFPP_Data, DeleteBytes )
     ASSERT_TRUE( d1.GetBytePtr()[ 1 ] == 0xEF );
 }
 
+TEST( CFPP_Data, Reserve )
+{
+    CF::Data       d( { 0xFF } );
+    CF::Data::Byte b;
+    CFIndex        i;
+    
+    d.Reserve( 4096 );
+    
+    ASSERT_EQ( d.GetLength(), 1 );
+    ASSERT_EQ( d[ 0 ], 0xFF );
+    
+    b = 0x01;
+    
+    for( i = 0; i < 4000; i++ )
+    {
+        d += b;
+    }
+    
+    ASSERT_EQ( d.GetLength(), 4001 );
+    
+    d.Reserve( 10 );
+    
+    ASSERT_EQ( d.GetLength(), 4001 );
+    ASSERT_NO_FATAL_FAILURE( CF::Data( static_cast< CFDataRef >( nullptr ) ).Reserve( 10 ) );
+}
+
+TEST( CFPP_Data, ShrinkToFit )
+{
+    CF::Data d1( 4096 );
+    CF::Data d2;
+    
+    d1 += std::string( "hello" );
+    d2  = d1;
+    
+    d1.ShrinkToFit();
+    
+    ASSERT_EQ( d1.GetLength(), 5 );
+    ASSERT_EQ( d1[ 4 ], 'o' );
+    ASSERT_EQ( d2.GetLength(), 5 );
+    ASSERT_NO_FATAL_FAILURE( CF::Data( static_cast< CFDataRef >( nullptr ) ).ShrinkToFit() );
+}
+
 TEST( CFPP_Data, Find )
 {
     CFRange  r;
@@ -810,6 +1130,101 @@ TEST( CFPP_Data, Find )
     ASSERT_TRUE( r.location == kCFNotFound );
 }
 
+TEST( CFPP_Data, Find_LongInput )
+{
+    std::string s( 4096, 'a' );
+    std::string n1( "abcdefgh" );
+    std::string n2( 100, 'a' );
+    CF::Data    d;
+    CFRange     r;
+    
+    n2[ 99 ] = 'z';
+    
+    s.replace( 3000, n1.length(), n1 );
+    s.replace( 3500, n2.length(), n2 );
+    
+    d = CF::Data( s );
+    r = d.Find( n1, CFRangeMake( 0, d.GetLength() ), 0 );
+    
+    ASSERT_EQ( r.location, 3000 );
+    ASSERT_EQ( r.length,   8 );
+    
+    r = d.Find( n2, CFRangeMake( 0, d.GetLength() ), 0 );
+    
+    ASSERT_EQ( r.location, 3500 );
+    ASSERT_EQ( r.length,   100 );
+    
+    r = d.Find( n2, CFRangeMake( 0, 3599 ), 0 );
+    
+    ASSERT_EQ( r.location, kCFNotFound );
+    
+    r = d.Find( std::string( "a" ), CFRangeMake( 0, d.GetLength() ), kCFDataSearchBackwards );
+    
+    ASSERT_EQ( r.location, 4095 );
+}
+
+TEST( CFPP_Data, FindAny )
+{
+    CF::Data d( std::string( "key: value\r\nnext\n" ) );
+    CFRange  r;
+    CFIndex  i;
+    
+    r = d.FindAny( { CF::DataView( d ).Slice( CFRangeMake( 10, 2 ) ), CF::DataView( d ).Slice( CFRangeMake( 3, 1 ) ) }, CFRangeMake( 0, d.GetLength() ), &i );
+    
+    ASSERT_EQ( r.location, 3 );
+    ASSERT_EQ( r.length,   1 );
+    ASSERT_EQ( i,          1 );
+    
+    r = d.FindAny( { CF::DataView( d ).Slice( CFRangeMake( 10, 2 ) ) }, CFRangeMake( 4, d.GetLength() - 4 ), &i );
+    
+    ASSERT_EQ( r.location, 10 );
+    ASSERT_EQ( r.length,   2 );
+    ASSERT_EQ( i,          0 );
+    
+    r = d.FindAny( {}, CFRangeMake( 0, d.GetLength() ), &i );
+    
+    ASSERT_EQ( r.location, kCFNotFound );
+    ASSERT_EQ( i,          kCFNotFound );
+    
+    r = CF::Data( static_cast< CFDataRef >( nullptr ) ).FindAny( { CF::DataView( d ) }, CFRangeMake( 0, 0 ) );
+    
+    ASSERT_EQ( r.location, kCFNotFound );
+}
+
+TEST( CFPP_Data, CBeginCEnd )
+{
+    CF::Data                      d1( __bytes, sizeof( __bytes ) );
+    CF::Data                      d2( static_cast< CFDataRef >( nullptr ) );
+    std::vector< CF::Data::Byte > v;
+    
+    ASSERT_TRUE( d1.cbegin() == d1.GetBytePtr() );
+    ASSERT_TRUE( d1.cend()   == d1.GetBytePtr() + d1.GetLength() );
+    ASSERT_TRUE( d2.cbegin() == d2.cend() );
+    
+    std::copy( d1.cbegin(), d1.cend(), std::back_inserter( v ) );
+    
+    ASSERT_EQ( v.size(), sizeof( __bytes ) );
+    ASSERT_EQ( v[ 3 ], 0xEF );
+    ASSERT_TRUE( std::find( d1.cbegin(), d1.cend(), 0xBE ) == d1.cbegin() + 2 );
+    ASSERT_EQ( d1.cend() - d1.cbegin(), d1.GetLength() );
+}
+
+TEST( CFPP_Data, MutableBeginMutableEnd )
+{
+    CF::Data d1( __bytes, sizeof( __bytes ) );
+    CF::Data d2( d1 );
+    CF::Data d3( static_cast< CFDataRef >( nullptr ) );
+    
+    std::transform( d1.MutableBegin(), d1.MutableEnd(), d1.MutableBegin(), []( CF::Data::Byte b ) { return static_cast< CF::Data::Byte >( ~b ); } );
+    
+    ASSERT_EQ( d1[ 0 ], 0x21 );
+    ASSERT_EQ( d1[ 3 ], 0x10 );
+    ASSERT_EQ( d2[ 0 ], 0xDE );
+    ASSERT_EQ( d2[ 3 ], 0xEF );
+    ASSERT_TRUE( d1.MutableBegin() != d2.cbegin() );
+    ASSERT_TRUE( d3.MutableBegin() == d3.MutableEnd() );
+}
+
 TEST( CFPP_Data, Swap )
 {
     CF::Data d1;
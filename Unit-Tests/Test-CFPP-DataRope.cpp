@@ -0,0 +1,313 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+/*!
+ * @file        Test-CFPP-DataRope.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Unit tests for CF::DataRope
+ */
+
+#include <CF++.hpp>
+
+#define XSTEST_GTEST_COMPAT
+#include <XSTest/XSTest.hpp>
+
+static std::string __String( const CF::DataRope & rope );
+static std::string __String( const CF::DataRope & rope )
+{
+    return rope.GetData();
+}
+
+TEST( CFPP_DataRope, CTOR )
+{
+    CF::DataRope r;
+    
+    ASSERT_EQ( r.GetLength(), 0 );
+    ASSERT_EQ( r.GetChunkCount(), 0 );
+    ASSERT_TRUE( r.IsEmpty() );
+}
+
+TEST( CFPP_DataRope, CTOR_Data )
+{
+    CF::DataRope r1( CF::Data( std::string( "hello" ) ) );
+    CF::DataRope r2( CF::Data( std::string( "" ) ) );
+    
+    ASSERT_EQ( r1.GetLength(), 5 );
+    ASSERT_EQ( r1.GetChunkCount(), 1 );
+    ASSERT_EQ( __String( r1 ), "hello" );
+    ASSERT_TRUE( r2.IsEmpty() );
+}
+
+TEST( CFPP_DataRope, CTOR_Data_MutableBytePtr )
+{
+    CF::Data         d( std::string( "hello" ) );
+    CF::Data::Byte * p( d.GetMutableBytePtr() );
+    CF::DataRope     r( d );
+    
+    p[ 0 ] = 'j';
+    
+    ASSERT_EQ( std::string( d ), "jello" );
+    ASSERT_EQ( __String( r ), "hello" );
+}
+
+TEST( CFPP_DataRope, CTOR_DataView )
+{
+    std::string  s( "hello" );
+    CF::DataRope r( CF::DataView( reinterpret_cast< const CF::Data::Byte * >( s.data() ), 5 ) );
+    
+    s = "world";
+    
+    ASSERT_EQ( __String( r ), "hello" );
+}
+
+TEST( CFPP_DataRope, CCTOR )
+{
+    CF::DataRope r1( CF::Data( std::string( "hello" ) ) );
+    CF::DataRope r2( r1 );
+    
+    r1.Append( CF::Data( std::string( " world" ) ) );
+    
+    ASSERT_EQ( __String( r1 ), "hello world" );
+    ASSERT_EQ( __String( r2 ), "hello" );
+}
+
+TEST( CFPP_DataRope, MCTOR )
+{
+    CF::DataRope r1( CF::Data( std::string( "hello" ) ) );
+    CF::DataRope r2( std::move( r1 ) );
+    
+    ASSERT_TRUE( r1.IsEmpty() );
+    ASSERT_EQ( __String( r2 ), "hello" );
+}
+
+TEST( CFPP_DataRope, OperatorAssign )
+{
+    CF::DataRope r1( CF::Data( std::string( "hello" ) ) );
+    CF::DataRope r2;
+    
+    r2 = r1;
+    
+    ASSERT_EQ( __String( r2 ), "hello" );
+}
+
+TEST( CFPP_DataRope, OperatorPlusEqual )
+{
+    CF::DataRope r;
+    std::string  s( "!" );
+    
+    r += CF::Data( std::string( "hello" ) );
+    r += CF::DataRope( CF::Data( std::string( " world" ) ) );
+    r += CF::DataView( reinterpret_cast< const CF::Data::Byte * >( s.data() ), 1 );
+    
+    ASSERT_EQ( __String( r ), "hello world!" );
+}
+
+TEST( CFPP_DataRope, OperatorSubscript )
+{
+    CF::DataRope r( CF::Data( std::string( "hello" ) ) );
+    
+    r.Insert( 2, CF::Data( std::string( "XY" ) ) );
+    
+    ASSERT_EQ( r[ 0 ], 'h' );
+    ASSERT_EQ( r[ 2 ], 'X' );
+    ASSERT_EQ( r[ 3 ], 'Y' );
+    ASSERT_EQ( r[ 6 ], 'o' );
+    ASSERT_EQ( r[ 7 ], 0 );
+    ASSERT_EQ( r[ -1 ], 0 );
+}
+
+TEST( CFPP_DataRope, GetBytes )
+{
+    CF::DataRope   r( CF::Data( std::string( "hello" ) ) );
+    CF::Data::Byte b[ 4 ] = { 0, 0, 0, 0 };
+    
+    r.Append( CF::Data( std::string( "world" ) ) );
+    r.GetBytes( CFRangeMake( 3, 4 ), b );
+    
+    ASSERT_EQ( b[ 0 ], 'l' );
+    ASSERT_EQ( b[ 1 ], 'o' );
+    ASSERT_EQ( b[ 2 ], 'w' );
+    ASSERT_EQ( b[ 3 ], 'o' );
+    
+    r.GetBytes( CFRangeMake( 8, 4 ), b );
+    
+    ASSERT_EQ( b[ 0 ], 'l' );
+}
+
+TEST( CFPP_DataRope, Slice )
+{
+    CF::DataRope r1( CF::Data( std::string( "hello" ) ) );
+    CF::DataRope r2;
+    
+    r1.Append( CF::Data( std::string( " world" ) ) );
+    
+    r2 = r1.Slice( CFRangeMake( 3, 5 ) );
+    
+    ASSERT_EQ( __String( r2 ), "lo wo" );
+    ASSERT_EQ( __String( r1 ), "hello world" );
+    ASSERT_TRUE( r1.Slice( CFRangeMake( 8, 10 ) ).IsEmpty() );
+    ASSERT_TRUE( r1.Slice( CFRangeMake( -1, 2 ) ).IsEmpty() );
+}
+
+TEST( CFPP_DataRope, GetChunks )
+{
+    std::string  s( 4096, 'x' );
+    CF::DataRope r( CF::Data( s + s ) );
+    std::string  c;
+    
+    r.Insert( 4096, CF::Data( std::string( 2048, 'y' ) ) );
+    
+    for( const CF::DataView & v: r.GetChunks() )
+    {
+        c.append( reinterpret_cast< const char * >( v.GetBytePtr() ), static_cast< size_t >( v.GetLength() ) );
+    }
+    
+    ASSERT_EQ( r.GetChunkCount(), 3 );
+    ASSERT_EQ( r.GetChunks().size(), 3 );
+    ASSERT_EQ( c, s + std::string( 2048, 'y' ) + s );
+}
+
+TEST( CFPP_DataRope, GetData )
+{
+    CF::Data     d( std::string( "hello" ) );
+    CF::DataRope r( d );
+    
+    ASSERT_TRUE( r.GetData().GetBytePtr() == d.GetBytePtr() );
+    
+    r.Append( CF::Data( std::string( " world" ) ) );
+    
+    ASSERT_EQ( std::string( r.GetData() ), "hello world" );
+    ASSERT_TRUE( CF::DataRope().GetData().IsValid() );
+}
+
+TEST( CFPP_DataRope, Write )
+{
+    CF::DataRope    r( CF::Data( std::string( "hello" ) ) );
+    CF::WriteStream out( "/tmp/com.xs-labs.cfpp.rope" );
+    CF::ReadStream  in;
+    
+    r.Insert( 5, CF::Data( std::string( 5000, '!' ) ) );
+    r.Insert( 0, CF::Data( std::string( "> " ) ) );
+    
+    out.Open();
+    
+    ASSERT_TRUE( r.Write( out ) );
+    
+    out.Close();
+    in.Open( "/tmp/com.xs-labs.cfpp.rope" );
+    
+    ASSERT_EQ( std::string( in.Read() ), "> hello" + std::string( 5000, '!' ) );
+    
+    in.Close();
+}
+
+TEST( CFPP_DataRope, Insert )
+{
+    CF::DataRope r( CF::Data( std::string( "held" ) ) );
+    CF::DataRope s( CF::Data( std::string( "worl" ) ) );
+    
+    r.Insert( 3, CF::Data( std::string( "lo " ) ) );
+    r.Insert( 6, s );
+    r.Insert( 100, s );
+    r.Insert( -1, s );
+    
+    ASSERT_EQ( __String( r ), "hello world" );
+    
+    r.Insert( 0, r );
+    
+    ASSERT_EQ( __String( r ), "hello worldhello world" );
+}
+
+TEST( CFPP_DataRope, Insert_Small )
+{
+    CF::DataRope r( CF::Data( std::string( 100000, 'x' ) ) );
+    CFIndex      i;
+    
+    for( i = 0; i < 500; i++ )
+    {
+        r.Insert( 50000 + i, CF::Data( std::string( "a" ) ) );
+    }
+    
+    ASSERT_EQ( r.GetLength(), 100500 );
+    ASSERT_EQ( r.GetChunkCount(), 3 );
+    ASSERT_EQ( __String( r ), std::string( 50000, 'x' ) + std::string( 500, 'a' ) + std::string( 50000, 'x' ) );
+}
+
+TEST( CFPP_DataRope, Delete )
+{
+    CF::DataRope r( CF::Data( std::string( "hello" ) ) );
+    
+    r.Append( CF::Data( std::string( " big world" ) ) );
+    r.Delete( CFRangeMake( 5, 4 ) );
+    
+    ASSERT_EQ( __String( r ), "hello world" );
+    
+    r.Delete( CFRangeMake( 8, 10 ) );
+    r.Delete( CFRangeMake( -1, 1 ) );
+    
+    ASSERT_EQ( __String( r ), "hello world" );
+    
+    r.Delete( CFRangeMake( 0, r.GetLength() ) );
+    
+    ASSERT_TRUE( r.IsEmpty() );
+}
+
+TEST( CFPP_DataRope, Replace )
+{
+    CF::DataRope r( CF::Data( std::string( "hello world" ) ) );
+    
+    r.Replace( CFRangeMake( 6, 5 ), CF::Data( std::string( "there" ) ) );
+    
+    ASSERT_EQ( __String( r ), "hello there" );
+    
+    r.Replace( CFRangeMake( 0, 5 ), r.Slice( CFRangeMake( 6, 5 ) ) );
+    
+    ASSERT_EQ( __String( r ), "there there" );
+    
+    r.Replace( CFRangeMake( 5, 1 ), CF::DataRope() );
+    
+    ASSERT_EQ( __String( r ), "therethere" );
+}
+
+TEST( CFPP_DataRope, Clear )
+{
+    CF::DataRope r( CF::Data( std::string( "hello" ) ) );
+    
+    r.Clear();
+    
+    ASSERT_TRUE( r.IsEmpty() );
+    ASSERT_EQ( r.GetLength(), 0 );
+}
+
+TEST( CFPP_DataRope, Swap )
+{
+    CF::DataRope r1( CF::Data( std::string( "hello" ) ) );
+    CF::DataRope r2;
+    
+    swap( r1, r2 );
+    
+    ASSERT_TRUE( r1.IsEmpty() );
+    ASSERT_EQ( __String( r2 ), "hello" );
+}
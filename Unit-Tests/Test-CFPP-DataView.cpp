@@ -0,0 +1,385 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+/*!
+ * @file        Test-CFPP-DataView.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Unit tests for CF::DataView
+ */
+
+#include <CF++.hpp>
+
+#define XSTEST_GTEST_COMPAT
+#include <XSTest/XSTest.hpp>
+
+static const CF::Data::Byte __bytes[] = { 0xDE, 0xAD, 0xBE, 0xEF, 0xDE, 0xAD };
+
+TEST( CFPP_DataView, CTOR )
+{
+    CF::DataView v;
+    
+    ASSERT_TRUE( v.GetBytePtr() == nullptr );
+    ASSERT_EQ( v.GetLength(), 0 );
+    ASSERT_TRUE( v.IsEmpty() );
+    ASSERT_FALSE( v.IsRetaining() );
+}
+
+TEST( CFPP_DataView, CTOR_Data )
+{
+    CF::Data     d( __bytes, sizeof( __bytes ) );
+    CF::DataView v( d );
+    
+    ASSERT_TRUE( v.GetBytePtr() == d.GetBytePtr() );
+    ASSERT_EQ( v.GetLength(), d.GetLength() );
+    ASSERT_FALSE( v.IsRetaining() );
+}
+
+TEST( CFPP_DataView, CTOR_Data_CFRange )
+{
+    CF::Data     d( __bytes, sizeof( __bytes ) );
+    CF::DataView v1( d, CFRangeMake( 2, 2 ) );
+    CF::DataView v2( d, CFRangeMake( 4, 100 ) );
+    CF::DataView v3( d, CFRangeMake( 100, 2 ) );
+    
+    ASSERT_TRUE( v1.GetBytePtr() == d.GetBytePtr() + 2 );
+    ASSERT_EQ( v1.GetLength(), 2 );
+    ASSERT_EQ( v2.GetLength(), 2 );
+    ASSERT_TRUE( v3.IsEmpty() );
+}
+
+TEST( CFPP_DataView, CTOR_BytePtr )
+{
+    CF::DataView v1( __bytes, sizeof( __bytes ) );
+    CF::DataView v2( nullptr, 4 );
+    CF::DataView v3( __bytes, -1 );
+    
+    ASSERT_TRUE( v1.GetBytePtr() == __bytes );
+    ASSERT_EQ( v1.GetLength(), static_cast< CFIndex >( sizeof( __bytes ) ) );
+    ASSERT_TRUE( v2.IsEmpty() );
+    ASSERT_TRUE( v3.IsEmpty() );
+}
+
+TEST( CFPP_DataView, Retaining )
+{
+    CF::DataView v;
+    
+    {
+        CF::Data d( __bytes, sizeof( __bytes ) );
+        
+        v = CF::DataView::Retaining( d, CFRangeMake( 1, 3 ) );
+        
+        ASSERT_TRUE( v.IsRetaining() );
+        ASSERT_TRUE( v.GetBytePtr() == d.GetBytePtr() + 1 );
+        
+        d += std::vector< CF::Data::Byte >( 16384, 42 );
+        
+        ASSERT_EQ( d.GetLength(), static_cast< CFIndex >( sizeof( __bytes ) ) + 16384 );
+        ASSERT_EQ( v.GetLength(), 3 );
+        ASSERT_EQ( v[ 0 ], 0xAD );
+        ASSERT_EQ( v[ 1 ], 0xBE );
+        ASSERT_EQ( v[ 2 ], 0xEF );
+    }
+    
+    ASSERT_EQ( v[ 0 ], 0xAD );
+    ASSERT_EQ( v[ 1 ], 0xBE );
+    ASSERT_EQ( v[ 2 ], 0xEF );
+    
+    ASSERT_FALSE( CF::DataView::Retaining( CF::Data( nullptr ) ).IsRetaining() );
+}
+
+TEST( CFPP_DataView, Retaining_MutableBytePtr )
+{
+    CF::Data         d( __bytes, sizeof( __bytes ) );
+    CF::Data::Byte * p( d.GetMutableBytePtr() );
+    CF::DataView     v( CF::DataView::Retaining( d ) );
+    
+    p[ 0 ] = 0x00;
+    
+    ASSERT_EQ( d[ 0 ], 0x00 );
+    ASSERT_EQ( v[ 0 ], 0xDE );
+}
+
+TEST( CFPP_DataView, CCTOR )
+{
+    CF::Data     d( __bytes, sizeof( __bytes ) );
+    CF::DataView v1( CF::DataView::Retaining( d ) );
+    CF::DataView v2( v1 );
+    
+    ASSERT_TRUE( v2.GetBytePtr() == v1.GetBytePtr() );
+    ASSERT_EQ( v2.GetLength(), v1.GetLength() );
+    ASSERT_TRUE( v2.IsRetaining() );
+}
+
+TEST( CFPP_DataView, MCTOR )
+{
+    CF::Data     d( __bytes, sizeof( __bytes ) );
+    CF::DataView v1( CF::DataView::Retaining( d ) );
+    CF::DataView v2( std::move( v1 ) );
+    
+    ASSERT_TRUE( v1.IsEmpty() );
+    ASSERT_FALSE( v1.IsRetaining() );
+    ASSERT_TRUE( v2.GetBytePtr() == d.GetBytePtr() );
+    ASSERT_TRUE( v2.IsRetaining() );
+}
+
+TEST( CFPP_DataView, OperatorAssign )
+{
+    CF::DataView v1( __bytes, sizeof( __bytes ) );
+    CF::DataView v2;
+    
+    v2 = v1;
+    
+    ASSERT_TRUE( v2.GetBytePtr() == __bytes );
+    ASSERT_EQ( v2.GetLength(), static_cast< CFIndex >( sizeof( __bytes ) ) );
+}
+
+TEST( CFPP_DataView, OperatorEqual )
+{
+    CF::Data     d( __bytes, sizeof( __bytes ) );
+    CF::DataView v1( __bytes, sizeof( __bytes ) );
+    CF::DataView v2( d );
+    CF::DataView v3( __bytes, 4 );
+    
+    ASSERT_TRUE(  v1 == v2 );
+    ASSERT_FALSE( v1 == v3 );
+    ASSERT_TRUE(  v1.Slice( CFRangeMake( 0, 2 ) ) == v1.Slice( 4 ) );
+    ASSERT_TRUE(  CF::DataView() == CF::DataView() );
+}
+
+TEST( CFPP_DataView, OperatorNotEqual )
+{
+    CF::DataView v1( __bytes, sizeof( __bytes ) );
+    CF::DataView v2( __bytes, 4 );
+    
+    ASSERT_TRUE(  v1 != v2 );
+    ASSERT_FALSE( v1 != v1 );
+}
+
+TEST( CFPP_DataView, OperatorLess )
+{
+    CF::DataView v1( __bytes, sizeof( __bytes ) );
+    CF::DataView v2( __bytes, 4 );
+    CF::DataView v3( __bytes + 2, 2 );
+    
+    ASSERT_TRUE(  v2 < v1 );
+    ASSERT_FALSE( v1 < v2 );
+    ASSERT_TRUE(  v3 < v1 );
+    ASSERT_FALSE( v1 < v1 );
+}
+
+TEST( CFPP_DataView, OperatorSubscript )
+{
+    CF::DataView v( __bytes, sizeof( __bytes ) );
+    
+    ASSERT_EQ( v[ 0 ], 0xDE );
+    ASSERT_EQ( v[ 3 ], 0xEF );
+    ASSERT_EQ( v[ 6 ], 0 );
+    ASSERT_EQ( v[ -1 ], 0 );
+}
+
+TEST( CFPP_DataView, Compare )
+{
+    CF::DataView v1( __bytes, sizeof( __bytes ) );
+    CF::DataView v2( __bytes, 4 );
+    
+    ASSERT_EQ( v1.Compare( v1 ), 0 );
+    ASSERT_EQ( v1.Compare( v2 ), 1 );
+    ASSERT_EQ( v2.Compare( v1 ), -1 );
+    ASSERT_EQ( v1.Slice( 1 ).Compare( v1 ), -1 );
+}
+
+TEST( CFPP_DataView, Slice )
+{
+    CF::DataView v( __bytes, sizeof( __bytes ) );
+    
+    ASSERT_TRUE( v.Slice( 2 ).GetBytePtr() == __bytes + 2 );
+    ASSERT_EQ( v.Slice( 2 ).GetLength(), 4 );
+    ASSERT_EQ( v.Slice( CFRangeMake( 1, 2 ) ).GetLength(), 2 );
+    ASSERT_EQ( v.Slice( CFRangeMake( 1, 2 ) )[ 1 ], 0xBE );
+    ASSERT_EQ( v.Slice( CFRangeMake( 5, 10 ) ).GetLength(), 1 );
+    ASSERT_TRUE( v.Slice( 6 ).IsEmpty() );
+    ASSERT_TRUE( v.Slice( 7 ).IsEmpty() );
+    ASSERT_TRUE( v.Slice( -1 ).IsEmpty() );
+}
+
+TEST( CFPP_DataView, Find )
+{
+    CF::DataView         v( __bytes, sizeof( __bytes ) );
+    const CF::Data::Byte n1[] = { 0xDE, 0xAD };
+    const CF::Data::Byte n2[] = { 0xAD, 0xDE };
+    CFRange              r;
+    
+    r = v.Find( CF::DataView( n1, sizeof( n1 ) ) );
+    
+    ASSERT_EQ( r.location, 0 );
+    ASSERT_EQ( r.length,   2 );
+    
+    r = v.Find( CF::DataView( n1, sizeof( n1 ) ), CFRangeMake( 1, 5 ), 0 );
+    
+    ASSERT_EQ( r.location, 4 );
+    ASSERT_EQ( r.length,   2 );
+    
+    r = v.Find( CF::DataView( n1, sizeof( n1 ) ), CFRangeMake( 0, 6 ), kCFDataSearchBackwards );
+    
+    ASSERT_EQ( r.location, 4 );
+    
+    r = v.Find( CF::DataView( n1, sizeof( n1 ) ), CFRangeMake( 1, 5 ), kCFDataSearchAnchored );
+    
+    ASSERT_EQ( r.location, kCFNotFound );
+    
+    r = v.Find( CF::DataView( n1, sizeof( n1 ) ), CFRangeMake( 0, 5 ), kCFDataSearchBackwards | kCFDataSearchAnchored );
+    
+    ASSERT_EQ( r.location, kCFNotFound );
+    
+    r = v.Find( CF::DataView( n2, sizeof( n2 ) ) );
+    
+    ASSERT_EQ( r.location, kCFNotFound );
+    ASSERT_EQ( r.length,   0 );
+    
+    r = v.Find( CF::DataView() );
+    
+    ASSERT_EQ( r.location, kCFNotFound );
+}
+
+TEST( CFPP_DataView, Find_LongNeedle )
+{
+    std::vector< CF::Data::Byte > bytes( 1000, 0xAA );
+    CF::DataView                  v( bytes.data(), static_cast< CFIndex >( bytes.size() ) );
+    CFRange                       r;
+    
+    bytes[ 999 ] = 0xBB;
+    
+    r = v.Find( v.Slice( 900 ) );
+    
+    ASSERT_EQ( r.location, 900 );
+    ASSERT_EQ( r.length,   100 );
+    
+    r = v.Find( v.Slice( CFRangeMake( 0, 40 ) ), CFRangeMake( 0, 1000 ), kCFDataSearchBackwards );
+    
+    ASSERT_EQ( r.location, 959 );
+    
+    r = v.Find( v.Slice( 960 ), CFRangeMake( 0, 999 ), 0 );
+    
+    ASSERT_EQ( r.location, kCFNotFound );
+}
+
+TEST( CFPP_DataView, FindAny )
+{
+    CF::DataView         v( __bytes, sizeof( __bytes ) );
+    const CF::Data::Byte n1[] = { 0xBE, 0xEF };
+    const CF::Data::Byte n2[] = { 0xEF };
+    const CF::Data::Byte n3[] = { 0xAD, 0xDE };
+    CFRange              r;
+    CFIndex              i;
+    
+    r = v.FindAny( { CF::DataView( n2, sizeof( n2 ) ), CF::DataView( n1, sizeof( n1 ) ) } );
+    
+    ASSERT_EQ( r.location, 2 );
+    ASSERT_EQ( r.length,   2 );
+    
+    r = v.FindAny( { CF::DataView( n3, sizeof( n3 ) ), CF::DataView( n2, sizeof( n2 ) ) }, CFRangeMake( 0, 6 ), &i );
+    
+    ASSERT_EQ( r.location, 3 );
+    ASSERT_EQ( r.length,   1 );
+    ASSERT_EQ( i,          1 );
+    
+    r = v.FindAny( { CF::DataView( n1, sizeof( n1 ) ) }, CFRangeMake( 0, 3 ), &i );
+    
+    ASSERT_EQ( r.location, kCFNotFound );
+    ASSERT_EQ( i,          kCFNotFound );
+    
+    r = v.FindAny( { CF::DataView(), CF::DataView( n3, sizeof( n3 ) ) }, CFRangeMake( 10, 3 ), &i );
+    
+    ASSERT_EQ( r.location, kCFNotFound );
+    ASSERT_EQ( i,          kCFNotFound );
+}
+
+TEST( CFPP_DataView, HasPrefix )
+{
+    CF::DataView v( __bytes, sizeof( __bytes ) );
+    
+    ASSERT_TRUE(  v.HasPrefix( v.Slice( CFRangeMake( 4, 2 ) ) ) );
+    ASSERT_FALSE( v.HasPrefix( v.Slice( 1 ) ) );
+    ASSERT_TRUE(  v.HasPrefix( CF::DataView() ) );
+}
+
+TEST( CFPP_DataView, HasSuffix )
+{
+    CF::DataView v( __bytes, sizeof( __bytes ) );
+    
+    ASSERT_TRUE(  v.HasSuffix( v.Slice( CFRangeMake( 0, 2 ) ) ) );
+    ASSERT_FALSE( v.HasSuffix( v.Slice( CFRangeMake( 0, 3 ) ) ) );
+    ASSERT_TRUE(  v.HasSuffix( CF::DataView() ) );
+}
+
+TEST( CFPP_DataView, GetData )
+{
+    CF::DataView v( __bytes, sizeof( __bytes ) );
+    CF::Data     d( v.Slice( 2 ).GetData() );
+    
+    ASSERT_TRUE( d.IsValid() );
+    ASSERT_EQ( d.GetLength(), 4 );
+    ASSERT_TRUE( d.GetBytePtr() != __bytes + 2 );
+    ASSERT_EQ( d[ 0 ], 0xBE );
+}
+
+#if __cplusplus >= 202002L
+TEST( CFPP_DataView, GetSpan )
+{
+    CF::DataView                      v( __bytes, sizeof( __bytes ) );
+    std::span< const CF::Data::Byte > s( v.GetSpan() );
+    
+    ASSERT_TRUE( s.data() == __bytes );
+    ASSERT_EQ( s.size(), sizeof( __bytes ) );
+    ASSERT_TRUE( CF::DataView( s.subspan( 4 ) ) == v.Slice( 4 ) );
+}
+#endif
+
+TEST( CFPP_DataView, BeginEnd )
+{
+    CF::DataView v( __bytes, sizeof( __bytes ) );
+    CFIndex      n;
+    
+    n = 0;
+    
+    for( CF::Data::Byte b: v )
+    {
+        ASSERT_EQ( b, __bytes[ n++ ] );
+    }
+    
+    ASSERT_EQ( n, v.GetLength() );
+    ASSERT_TRUE( CF::DataView().begin() == CF::DataView().end() );
+}
+
+TEST( CFPP_DataView, Swap )
+{
+    CF::DataView v1( __bytes, sizeof( __bytes ) );
+    CF::DataView v2( __bytes, 2 );
+    
+    swap( v1, v2 );
+    
+    ASSERT_EQ( v1.GetLength(), 2 );
+    ASSERT_EQ( v2.GetLength(), static_cast< CFIndex >( sizeof( __bytes ) ) );
+}
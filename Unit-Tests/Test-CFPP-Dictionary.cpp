@@ -373,6 +373,22 @@ TEST( CFPP_Dictionary, OperatorSubscriptString )
     ASSERT_EQ( CFGetTypeID( d1[ CF::String( "foo" ) ] ), CFStringGetTypeID() );
 }
 
+TEST( CFPP_Dictionary, OperatorSubscriptStaticString )
+{
+    CF::Dictionary d1;
+    CF::Dictionary d2( static_cast< CFArrayRef >( nullptr ) );
+    
+    d1 << CF::Pair( "foo", "hello, world" );
+    
+    ASSERT_NO_THROW( d2[ CFPP_STR( "bar" ) ] );
+    
+    ASSERT_TRUE( d1[ CFPP_STR( "foo" ) ] != nullptr );
+    ASSERT_TRUE( d1[ CFPP_STR( "bar" ) ] == nullptr );
+    ASSERT_TRUE( d2[ CFPP_STR( "foo" ) ] == nullptr );
+    
+    ASSERT_EQ( CFGetTypeID( d1[ CFPP_STR( "foo" ) ] ), CFStringGetTypeID() );
+}
+
 TEST( CFPP_Dictionary, GetTypeID )
 {
     CF::Dictionary d;
@@ -441,6 +457,18 @@ TEST( CFPP_Dictionary, ContainsKeyString )
     ASSERT_FALSE( d1.ContainsKey( CF::String( "hello, universe" ) ) );
 }
 
+TEST( CFPP_Dictionary, ContainsKeyStaticString )
+{
+    CF::Dictionary d1;
+    CF::Dictionary d2( static_cast< CFArrayRef >( nullptr ) );
+    
+    d1 << CF::Pair( CF::String( "hello, world" ), CF::String( "foo" ) );
+    
+    ASSERT_TRUE(  d1.ContainsKey( CFPP_STR( "hello, world" ) ) );
+    ASSERT_FALSE( d2.ContainsKey( CFPP_STR( "hello, world" ) ) );
+    ASSERT_FALSE( d1.ContainsKey( CFPP_STR( "hello, universe" ) ) );
+}
+
 TEST( CFPP_Dictionary, ContainsValue )
 {
     CF::Dictionary d1;
@@ -581,6 +609,20 @@ TEST( CFPP_Dictionary, GetValueString )
     ASSERT_TRUE( d1.GetValue( CF::String( "bar" ) ) != nullptr );
 }
 
+TEST( CFPP_Dictionary, GetValueStaticString )
+{
+    CF::Dictionary d1;
+    CF::Dictionary d2( static_cast< CFArrayRef >( nullptr ) );
+    
+    ASSERT_TRUE( d1.GetValue( CFPP_STR( "foo" ) ) == nullptr );
+    ASSERT_TRUE( d2.GetValue( CFPP_STR( "foo" ) ) == nullptr );
+    
+    d1 << CF::Pair( CF::String( "foo" ), CF::String( "hello, world" ) );
+    
+    ASSERT_TRUE( d1.GetValue( CFPP_STR( "foo" ) ) != nullptr );
+    ASSERT_TRUE( d1.GetValue( CFPP_STR( "bar" ) ) == nullptr );
+}
+
 TEST( CFPP_Dictionary, AddValueCFType )
 {
     CF::Dictionary d1;
@@ -641,6 +683,19 @@ TEST( CFPP_Dictionary, AddValueString )
     ASSERT_TRUE( CF::String( d1[ "foo" ] ) == "hello, world" );
 }
 
+TEST( CFPP_Dictionary, AddValueStaticString )
+{
+    CF::Dictionary d1;
+    CF::Dictionary d2( static_cast< CFArrayRef >( nullptr ) );
+    
+    ASSERT_NO_THROW( d2.AddValue( CFPP_STR( "foo" ), CF::String( "hello, world" ) ) );
+    
+    d1.AddValue( CFPP_STR( "foo" ), CF::String( "hello, world" ) );
+    d1.AddValue( CFPP_STR( "foo" ), CF::String( "hello, universe" ) );
+    
+    ASSERT_TRUE( CF::String( d1[ "foo" ] ) == "hello, world" );
+}
+
 TEST( CFPP_Dictionary, RemoveValueCFType )
 {
     CF::Dictionary d1;
@@ -707,6 +762,22 @@ TEST( CFPP_Dictionary, RemoveValueString )
     ASSERT_NO_THROW( d2.RemoveValue( CF::String( "foo" ) ) );
 }
 
+TEST( CFPP_Dictionary, RemoveValueStaticString )
+{
+    CF::Dictionary d1;
+    CF::Dictionary d2( static_cast< CFArrayRef >( nullptr ) );
+    
+    ASSERT_NO_THROW( d2.RemoveValue( CFPP_STR( "foo" ) ) );
+    
+    d1 << CF::Pair( "foo", "hello, world" );
+    
+    ASSERT_EQ( d1.GetCount(), 1 );
+    
+    d1.RemoveValue( CFPP_STR( "foo" ) );
+    
+    ASSERT_EQ( d1.GetCount(), 0 );
+}
+
 TEST( CFPP_Dictionary, ReplaceValueCFType )
 {
     CF::Dictionary d1;
@@ -773,6 +844,21 @@ TEST( CFPP_Dictionary, ReplaceValueString )
     ASSERT_NO_THROW( d2.ReplaceValue( CF::String( "foo" ), CF::String( "bar" ) ) );
 }
 
+TEST( CFPP_Dictionary, ReplaceValueStaticString )
+{
+    CF::Dictionary d1;
+    
+    d1.ReplaceValue( CFPP_STR( "foo" ), CF::String( "hello, world" ) );
+    
+    ASSERT_EQ( d1.GetCount(), 0 );
+    
+    d1 << CF::Pair( "foo", "hello, world" );
+    
+    d1.ReplaceValue( CFPP_STR( "foo" ), CF::String( "hello, universe" ) );
+    
+    ASSERT_TRUE( CF::String( d1[ "foo" ] ) == "hello, universe" );
+}
+
 TEST( CFPP_Dictionary, SetValueCFType )
 {
     CF::Dictionary d1;
@@ -833,6 +919,19 @@ TEST( CFPP_Dictionary, SetValueString )
     ASSERT_TRUE( CF::String( d1[ "foo" ] ) == "hello, universe" );
 }
 
+TEST( CFPP_Dictionary, SetValueStaticString )
+{
+    CF::Dictionary d1;
+    
+    d1.SetValue( CFPP_STR( "foo" ), CF::String( "hello, world" ) );
+    
+    ASSERT_TRUE( CF::String( d1[ "foo" ] ) == "hello, world" );
+    
+    d1.SetValue( CFPP_STR( "foo" ), CF::String( "hello, universe" ) );
+    
+    ASSERT_TRUE( CF::String( d1[ "foo" ] ) == "hello, universe" );
+}
+
 TEST( CFPP_Dictionary, AddValueCFType_CChar )
 {
     CF::Dictionary d1;
@@ -1019,6 +1118,20 @@ TEST( CFPP_Dictionary, SetValueString_CChar )
     ASSERT_TRUE( CF::String( d1[ "foo" ] ) == "hello, universe" );
 }
 
+TEST( CFPP_Dictionary, SetValueStaticString_CChar )
+{
+    CF::Dictionary d1;
+    
+    d1.SetValue( CFPP_STR( "foo" ), "hello, world" );
+    
+    ASSERT_TRUE( CF::String( d1[ "foo" ] ) == "hello, world" );
+    
+    d1.AddValue( CFPP_STR( "bar" ), "hello, universe" );
+    d1.ReplaceValue( CFPP_STR( "bar" ), "hello, world" );
+    
+    ASSERT_TRUE( CF::String( d1[ "bar" ] ) == "hello, world" );
+}
+
 TEST( CFPP_Dictionary, Swap )
 {
     CF::Dictionary d1;
@@ -0,0 +1,205 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        Test-CFPP-Parallel.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Unit tests for CF::Parallel
+ */
+
+#include <CF++.hpp>
+
+#define XSTEST_GTEST_COMPAT
+#include <XSTest/XSTest.hpp>
+
+static CF::Array __Numbers( int count );
+static CF::Array __Numbers( int count )
+{
+    std::vector< CF::Number > v;
+    
+    for( int i = 0; i < count; i++ )
+    {
+        v.push_back( CF::Number( ( i * 7919 ) % count ) );
+    }
+    
+    return CF::Array( std::vector< CFTypeRef >( v.begin(), v.end() ) );
+}
+
+static bool __Less( CFTypeRef v1, CFTypeRef v2 );
+static bool __Less( CFTypeRef v1, CFTypeRef v2 )
+{
+    return CF::Number( v1 ) < CF::Number( v2 );
+}
+
+TEST( CFPP_Parallel, ForEach )
+{
+    CF::Array             a( __Numbers( 5000 ) );
+    CF::ThreadPool        p( 4 );
+    std::atomic< size_t > n( 0 );
+    std::atomic< int >    s( 0 );
+    
+    CF::Parallel::ForEach( a, [ & ]( CFTypeRef v ) { n++; s += CF::Number( v ).GetSignedIntValue(); }, p );
+    
+    ASSERT_EQ( n, 5000 );
+    ASSERT_EQ( s, 4999 * 5000 / 2 );
+}
+
+TEST( CFPP_Parallel, ForEach_Empty )
+{
+    CF::Array             a1;
+    CF::Array             a2( static_cast< CFArrayRef >( nullptr ) );
+    std::atomic< size_t > n( 0 );
+    
+    CF::Parallel::ForEach( a1, [ & ]( CFTypeRef v ) { ( void )v; n++; } );
+    CF::Parallel::ForEach( a2, [ & ]( CFTypeRef v ) { ( void )v; n++; } );
+    
+    ASSERT_EQ( n, 0 );
+}
+
+TEST( CFPP_Parallel, Map )
+{
+    CF::Array      a( __Numbers( 5000 ) );
+    CF::ThreadPool p( 4 );
+    CF::Array      m;
+    
+    m = CF::Parallel::Map( a, []( CFTypeRef v ) { return CF::Number( CF::Number( v ).GetSignedIntValue() * 2 ); }, p );
+    
+    ASSERT_EQ( m.GetCount(), 5000 );
+    
+    for( CFIndex i = 0; i < m.GetCount(); i++ )
+    {
+        ASSERT_EQ( CF::Number( m.GetValueAtIndex( i ) ).GetSignedIntValue(), CF::Number( a.GetValueAtIndex( i ) ).GetSignedIntValue() * 2 );
+    }
+}
+
+TEST( CFPP_Parallel, Map_Borrowed )
+{
+    CF::Array      a( __Numbers( 5000 ) );
+    CF::ThreadPool p( 4 );
+    CF::Array      m;
+    
+    m = CF::Parallel::Map( a, []( CFTypeRef v ) -> CFTypeRef { return ( CF::Number( v ) < 100 ) ? v : nullptr; }, p );
+    
+    ASSERT_EQ( m.GetCount(), 100 );
+}
+
+TEST( CFPP_Parallel, Filter )
+{
+    CF::Array      a( __Numbers( 5000 ) );
+    CF::ThreadPool p( 4 );
+    CF::Array      f;
+    CFIndex        j;
+    
+    f = CF::Parallel::Filter( a, []( CFTypeRef v ) { return CF::Number( v ) < 2500; }, p );
+    
+    ASSERT_EQ( f.GetCount(), 2500 );
+    
+    j = 0;
+    
+    for( CFIndex i = 0; i < a.GetCount(); i++ )
+    {
+        if( CF::Number( a.GetValueAtIndex( i ) ) < 2500 )
+        {
+            ASSERT_TRUE( f.GetValueAtIndex( j++ ) == a.GetValueAtIndex( i ) );
+        }
+    }
+}
+
+TEST( CFPP_Parallel, Reduce )
+{
+    CF::Array      a( __Numbers( 5000 ) );
+    CF::ThreadPool p( 4 );
+    long           s;
+    
+    s = CF::Parallel::Reduce
+    (
+        a,
+        0L,
+        []( long r, CFTypeRef v ) { return r + CF::Number( v ).GetSignedLongValue(); },
+        []( long r1, long r2 )    { return r1 + r2; },
+        p
+    );
+    
+    ASSERT_EQ( s, 4999L * 5000L / 2 );
+    ASSERT_EQ( CF::Parallel::Reduce( CF::Array(), 42L, []( long r, CFTypeRef v ) { ( void )v; return r; }, []( long r1, long r2 ) { return r1 + r2; } ), 42L );
+}
+
+TEST( CFPP_Parallel, Reduce_Bool )
+{
+    CF::Array      a( __Numbers( 5000 ) );
+    CF::ThreadPool p( 4 );
+    
+    auto any = [ & ]( int n )
+    {
+        return CF::Parallel::Reduce
+        (
+            a,
+            false,
+            [ = ]( bool r, CFTypeRef v ) { return r || CF::Number( v ).GetSignedIntValue() == n; },
+            []( bool r1, bool r2 )       { return r1 || r2; },
+            p
+        );
+    };
+    
+    ASSERT_TRUE(  any( 0 ) );
+    ASSERT_TRUE(  any( 4999 ) );
+    ASSERT_FALSE( any( 5000 ) );
+}
+
+TEST( CFPP_Parallel, Sort )
+{
+    CF::Array      a( __Numbers( 5000 ) );
+    CF::ThreadPool p( 4 );
+    CF::Array      s;
+    
+    s = CF::Parallel::Sort( a, __Less, p );
+    
+    ASSERT_EQ( s.GetCount(), 5000 );
+    
+    for( CFIndex i = 0; i < s.GetCount(); i++ )
+    {
+        ASSERT_EQ( CF::Number( s.GetValueAtIndex( i ) ).GetSignedIntValue(), static_cast< int >( i ) );
+    }
+    
+    ASSERT_FALSE( CF::Number( a[ 1 ] ).GetSignedIntValue() == 1 );
+    ASSERT_EQ( CF::Parallel::Sort( CF::Array(), __Less, p ).GetCount(), 0 );
+}
+
+TEST( CFPP_Parallel, Scaling )
+{
+    CF::Array a( __Numbers( 20000 ) );
+    CF::Array s1;
+    CF::Array f1;
+    
+    s1 = CF::Parallel::Sort( a, __Less, CF::ThreadPool::GetShared() );
+    f1 = CF::Parallel::Filter( a, []( CFTypeRef v ) { return CF::Number( v ) < 1000; } );
+    
+    for( size_t threads: { 1, 2, 4, 8, 16 } )
+    {
+        CF::ThreadPool p( threads );
+        
+        ASSERT_TRUE( CF::Parallel::Sort( a, __Less, p ) == s1 );
+        ASSERT_TRUE( CF::Parallel::Filter( a, []( CFTypeRef v ) { return CF::Number( v ) < 1000; }, p ) == f1 );
+    }
+}
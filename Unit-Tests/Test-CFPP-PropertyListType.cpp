@@ -129,6 +129,26 @@ TEST( CFPP_PropertyListType, FromPropertyListData )
     }
 }
 
+TEST( CFPP_PropertyListType, FromPropertyListData_DataView )
+{
+    CF::Dictionary d;
+    CF::Data       data( std::string( "garbage" ) + __plist + "garbage" );
+    
+    d = CF::Dictionary::FromPropertyListData( CF::DataView( data, CFRangeMake( 7, static_cast< CFIndex >( strlen( __plist ) ) ) ) );
+    
+    ASSERT_TRUE( d.IsValid() );
+    ASSERT_EQ( d.GetCount(), 1 );
+    ASSERT_EQ( CF::String( d[ "hello" ] ), "world" );
+    
+    d = CF::Dictionary::FromPropertyListData( CF::DataView( data ) );
+    
+    ASSERT_FALSE( d.IsValid() );
+    
+    d = CF::Dictionary::FromPropertyListData( CF::DataView() );
+    
+    ASSERT_FALSE( d.IsValid() );
+}
+
 TEST( CFPP_PropertyListType, ToPropertyList_STDString_PropertyListFormat )
 {
     CF::Dictionary d1;
@@ -0,0 +1,192 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+/*!
+ * @file        Test-CFPP-SHA256.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Unit tests for CF::SHA256
+ */
+
+#include <CF++.hpp>
+
+#define XSTEST_GTEST_COMPAT
+#include <XSTest/XSTest.hpp>
+
+TEST( CFPP_SHA256, CTOR )
+{
+    CF::SHA256 h;
+    
+    ASSERT_TRUE( h.GetValue() == CF::Data::FromHex( "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855" ) );
+}
+
+TEST( CFPP_SHA256, CCTOR )
+{
+    CF::SHA256 h1;
+    
+    h1.Update( CF::Data( std::string( "abc" ) ) );
+    
+    {
+        CF::SHA256 h2( h1 );
+        
+        ASSERT_TRUE( h2.GetValue() == CF::Data::FromHex( "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad" ) );
+    }
+}
+
+TEST( CFPP_SHA256, MCTOR )
+{
+    CF::SHA256 h1;
+    
+    h1.Update( CF::Data( std::string( "abc" ) ) );
+    
+    {
+        CF::SHA256 h2( std::move( h1 ) );
+        
+        ASSERT_TRUE( h2.GetValue() == CF::Data::FromHex( "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad" ) );
+        ASSERT_TRUE( h1.GetValue() == CF::Data::FromHex( "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855" ) );
+    }
+}
+
+TEST( CFPP_SHA256, OperatorAssign )
+{
+    CF::SHA256 h1;
+    CF::SHA256 h2;
+    
+    h1.Update( CF::Data( std::string( "abc" ) ) );
+    
+    h2 = h1;
+    
+    ASSERT_TRUE( h2.GetValue() == CF::Data::FromHex( "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad" ) );
+}
+
+TEST( CFPP_SHA256, OperatorShiftLeft )
+{
+    CF::SHA256 h;
+    
+    h << CF::Data( std::string( "a" ) ) << CF::Data( std::string( "bc" ) );
+    
+    ASSERT_TRUE( h.GetValue() == CF::Data::FromHex( "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad" ) );
+}
+
+TEST( CFPP_SHA256, Update )
+{
+    CF::SHA256 h;
+    
+    h.Update( reinterpret_cast< const CF::Data::Byte * >( "123456789" ), 9 );
+    
+    ASSERT_TRUE( h.GetValue() == CF::Data::FromHex( "15e2b0d3c33891ebb0f1ef609ec419420c20e320ce94c65fbc8c3312448eb225" ) );
+    
+    h.Update( nullptr, 10 );
+    
+    ASSERT_TRUE( h.GetValue() == CF::Data::FromHex( "15e2b0d3c33891ebb0f1ef609ec419420c20e320ce94c65fbc8c3312448eb225" ) );
+}
+
+TEST( CFPP_SHA256, Update_TwoBlocks )
+{
+    std::string s1( "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq" );
+    std::string s2( "abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmnhijklmnoijklmnopjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu" );
+    CF::SHA256  h;
+    
+    /* 56 bytes leave no room for the length, so padding spills into a second block */
+    h << CF::Data( s1 );
+    
+    ASSERT_TRUE( h.GetValue() == CF::Data::FromHex( "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1" ) );
+    
+    h.Reset();
+    h << CF::Data( s2.substr( 0, 63 ) ) << CF::Data( s2.substr( 63 ) );
+    
+    ASSERT_TRUE( h.GetValue() == CF::Data::FromHex( "cf5b16a778af8380036ce59e7b0492370b249b11e8f07a51afac45037afee9d1" ) );
+}
+
+TEST( CFPP_SHA256, Update_Incremental )
+{
+    CF::Data   d( std::string( 1000000, 'a' ) );
+    CF::SHA256 h;
+    CFIndex    i;
+    
+    for( i = 0; i < d.GetLength(); i += 37 )
+    {
+        h.Update( CF::DataView( d, CFRangeMake( i, std::min< CFIndex >( 37, d.GetLength() - i ) ) ) );
+    }
+    
+    ASSERT_TRUE( h.GetValue() == CF::Data::FromHex( "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0" ) );
+}
+
+TEST( CFPP_SHA256, Update_Stream )
+{
+    CF::ReadStream s;
+    CF::Data       d;
+    CF::SHA256     h;
+    
+    s.Open( "/etc/hosts" );
+    
+    d = s.Read();
+    
+    s.Close();
+    s.Open( "/etc/hosts" );
+    
+    for( CF::ReadStream::Iterator it = s.begin( 16 ); it != s.end(); ++it )
+    {
+        h << *( it );
+    }
+    
+    s.Close();
+    
+    ASSERT_GT( d.GetLength(), 0 );
+    ASSERT_TRUE( h.GetValue() == d.GetSHA256() );
+}
+
+TEST( CFPP_SHA256, GetValue )
+{
+    CF::SHA256 h;
+    
+    h << CF::Data( std::string( "abc" ) );
+    
+    ASSERT_TRUE( h.GetValue() == CF::Data::FromHex( "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad" ) );
+    ASSERT_TRUE( h.GetValue() == CF::Data::FromHex( "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad" ) );
+}
+
+TEST( CFPP_SHA256, Reset )
+{
+    CF::SHA256 h;
+    
+    h << CF::Data( std::string( "abc" ) );
+    
+    h.Reset();
+    
+    ASSERT_TRUE( h.GetValue() == CF::Data::FromHex( "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855" ) );
+}
+
+TEST( CFPP_SHA256, Swap )
+{
+    CF::SHA256 h1;
+    CF::SHA256 h2;
+    
+    h1 << CF::Data( std::string( "abc" ) );
+    
+    swap( h1, h2 );
+    
+    ASSERT_TRUE( h1.GetValue() == CF::Data::FromHex( "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855" ) );
+    ASSERT_TRUE( h2.GetValue() == CF::Data::FromHex( "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad" ) );
+}
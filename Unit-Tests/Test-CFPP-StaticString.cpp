@@ -0,0 +1,187 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        Test-CFPP-StaticString.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Unit tests for CF::StaticString
+ */
+
+#include <CF++.hpp>
+
+#define XSTEST_GTEST_COMPAT
+#include <XSTest/XSTest.hpp>
+
+static CF::StaticString GetKey();
+static CF::StaticString GetKey()
+{
+    return CFPP_STR( "hello, world" );
+}
+
+TEST( CFPP_StaticString, Create )
+{
+    CFStringRef s1( CF::StaticString::Create( "hello, world" ) );
+    CFStringRef s2( CF::StaticString::Create( nullptr ) );
+    
+    ASSERT_TRUE( s1 != nullptr );
+    ASSERT_TRUE( s2 != nullptr );
+    ASSERT_TRUE( CF::String( s1 ) == "hello, world" );
+    ASSERT_TRUE( CF::String( s2 ) == "" );
+}
+
+TEST( CFPP_StaticString, CTOR )
+{
+    CF::StaticString s1( CFSTR( "hello, world" ) );
+    CF::StaticString s2( static_cast< CFStringRef >( nullptr ) );
+    CF::StaticString s3( static_cast< CFStringRef >( CF::Boolean().GetCFObject() ) );
+    
+    ASSERT_TRUE(  s1.IsValid() );
+    ASSERT_FALSE( s2.IsValid() );
+    ASSERT_FALSE( s3.IsValid() );
+}
+
+TEST( CFPP_StaticString, CCTOR )
+{
+    CF::StaticString s1( CFPP_STR( "hello, world" ) );
+    CF::StaticString s2( s1 );
+    
+    ASSERT_TRUE( s2.IsValid() );
+    ASSERT_TRUE( s1.GetCFObject() == s2.GetCFObject() );
+}
+
+TEST( CFPP_StaticString, OperatorAssign )
+{
+    CF::StaticString s1( CFPP_STR( "hello, world" ) );
+    CF::StaticString s2( CFPP_STR( "hello, universe" ) );
+    
+    s2 = s1;
+    
+    ASSERT_TRUE( s1.GetCFObject() == s2.GetCFObject() );
+}
+
+TEST( CFPP_StaticString, OperatorEqual )
+{
+    ASSERT_TRUE(  CFPP_STR( "hello, world" ) == CFPP_STR( "hello, world" ) );
+    ASSERT_FALSE( CFPP_STR( "hello, world" ) == CFPP_STR( "hello, universe" ) );
+    ASSERT_FALSE( CFPP_STR( "hello, world" ) == CF::StaticString( static_cast< CFStringRef >( nullptr ) ) );
+}
+
+TEST( CFPP_StaticString, OperatorNotEqual )
+{
+    ASSERT_FALSE( CFPP_STR( "hello, world" ) != CFPP_STR( "hello, world" ) );
+    ASSERT_TRUE(  CFPP_STR( "hello, world" ) != CFPP_STR( "hello, universe" ) );
+    ASSERT_TRUE(  CFPP_STR( "hello, world" ) != CF::StaticString( static_cast< CFStringRef >( nullptr ) ) );
+}
+
+TEST( CFPP_StaticString, SameInstance )
+{
+    ASSERT_TRUE( GetKey().GetCFObject() == GetKey().GetCFObject() );
+}
+
+TEST( CFPP_StaticString, CTOR_CFString )
+{
+    CFStringRef cf;
+    
+    cf = CFStringCreateWithCString( static_cast< CFAllocatorRef >( nullptr ), "hello, world", kCFStringEncodingUTF8 );
+    
+    {
+        CF::StaticString s1( cf );
+        
+        CFRelease( cf );
+        
+        CF::StaticString s2( s1 );
+        
+        ASSERT_TRUE( s2.GetCFObject() == cf );
+        ASSERT_EQ( s1.GetValue(), "hello, world" );
+        ASSERT_EQ( s2.GetValue(), "hello, world" );
+    }
+}
+
+TEST( CFPP_StaticString, Constant )
+{
+    CFStringRef cf;
+    CFIndex     rc;
+    
+    cf = CF::StaticString::Create( "hello, world" );
+    rc = CFGetRetainCount( cf );
+    
+    {
+        CF::StaticString s1( CF::StaticString::Constant( cf ) );
+        CF::StaticString s2( s1 );
+        
+        ASSERT_TRUE( s2.GetCFObject() == cf );
+        ASSERT_EQ( CFGetRetainCount( cf ), rc );
+        ASSERT_EQ( s2.GetValue(), "hello, world" );
+    }
+    
+    ASSERT_EQ( CFGetRetainCount( cf ), rc );
+    
+    CFRelease( cf );
+}
+
+TEST( CFPP_StaticString, GetTypeID )
+{
+    ASSERT_EQ( CFPP_STR( "hello, world" ).GetTypeID(), CFStringGetTypeID() );
+}
+
+TEST( CFPP_StaticString, GetCFObject )
+{
+    ASSERT_TRUE( CFPP_STR( "hello, world" ).GetCFObject() != nullptr );
+    ASSERT_TRUE( CF::StaticString( static_cast< CFStringRef >( nullptr ) ).GetCFObject() == nullptr );
+}
+
+TEST( CFPP_StaticString, GetLength )
+{
+    ASSERT_EQ( CFPP_STR( "hello, world" ).GetLength(), 12 );
+    ASSERT_EQ( CFPP_STR( "" ).GetLength(), 0 );
+    ASSERT_EQ( CF::StaticString( static_cast< CFStringRef >( nullptr ) ).GetLength(), 0 );
+}
+
+TEST( CFPP_StaticString, GetValue )
+{
+    ASSERT_EQ( CFPP_STR( "hello, world" ).GetValue(), "hello, world" );
+    ASSERT_EQ( CF::StaticString( static_cast< CFStringRef >( nullptr ) ).GetValue(), "" );
+}
+
+#if defined( __cpp_nontype_template_args ) && __cpp_nontype_template_args >= 201911L
+TEST( CFPP_StaticString, Literal )
+{
+    using namespace CF::Literals;
+    
+    ASSERT_TRUE( "hello, world"_cf.IsValid() );
+    ASSERT_TRUE( "hello, world"_cf == CFPP_STR( "hello, world" ) );
+    ASSERT_TRUE( "hello, world"_cf.GetCFObject() == "hello, world"_cf.GetCFObject() );
+}
+#endif
+
+TEST( CFPP_StaticString, Swap )
+{
+    CF::StaticString s1( CFPP_STR( "hello, world" ) );
+    CF::StaticString s2( CFPP_STR( "hello, universe" ) );
+    
+    swap( s1, s2 );
+    
+    ASSERT_EQ( s1.GetValue(), "hello, universe" );
+    ASSERT_EQ( s2.GetValue(), "hello, world" );
+}
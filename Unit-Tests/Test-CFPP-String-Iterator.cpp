@@ -551,3 +551,45 @@ TEST( CFPP_String_Iterator, TestIterateCPP11 )
         ASSERT_EQ( i, 5 );
     }
 }
+
+TEST( CFPP_String_Iterator, TestIterateUTF8 )
+{
+    CF::String           s( "h\xC3\xA9llo" );
+    CF::String::Iterator it;
+    std::string          str;
+    
+    for( it = s.begin(); it != s.end(); ++it )
+    {
+        str += *( it );
+    }
+    
+    ASSERT_EQ( str, "h\xC3\xA9llo" );
+    
+    str.clear();
+    
+    for( it = s.begin( kCFStringEncodingISOLatin1 ); it != s.end( kCFStringEncodingISOLatin1 ); ++it )
+    {
+        str += *( it );
+    }
+    
+    ASSERT_EQ( str, "h\xE9llo" );
+}
+
+TEST( CFPP_String_Iterator, TestIterateAfterAppend )
+{
+    CF::String           s( "hello" );
+    CF::String::Iterator it;
+    std::string          str;
+    
+    it  = s.begin();
+    s  += ", world";
+    
+    ASSERT_EQ( *( it ), 'h' );
+    
+    for( it = s.begin(); it != s.end(); ++it )
+    {
+        str += *( it );
+    }
+    
+    ASSERT_EQ( str, "hello, world" );
+}
@@ -0,0 +1,137 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        Test-CFPP-String-SplitRange-Iterator.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Unit tests for CF::String::SplitRange::Iterator
+ */
+
+#include <CF++.hpp>
+
+#define XSTEST_GTEST_COMPAT
+#include <XSTest/XSTest.hpp>
+
+TEST( CFPP_String_SplitRange_Iterator, CTOR )
+{
+    CF::String::SplitRange::Iterator i;
+    
+    ASSERT_EQ( i->GetLength(), 0 );
+    ASSERT_TRUE( i == CF::String::SplitRange::Iterator() );
+}
+
+TEST( CFPP_String_SplitRange_Iterator, CCTOR )
+{
+    CF::String                       s( "a,b" );
+    CF::String::SplitRange           r( s.Split( "," ) );
+    CF::String::SplitRange::Iterator i1( r.begin() );
+    CF::String::SplitRange::Iterator i2( i1 );
+    
+    ASSERT_TRUE( i1 == i2 );
+    ASSERT_EQ( i2->GetValue(), "a" );
+}
+
+TEST( CFPP_String_SplitRange_Iterator, OperatorAssign )
+{
+    CF::String                       s( "a,b" );
+    CF::String::SplitRange           r( s.Split( "," ) );
+    CF::String::SplitRange::Iterator i;
+    
+    i = r.begin();
+    
+    ASSERT_EQ( i->GetValue(), "a" );
+}
+
+TEST( CFPP_String_SplitRange_Iterator, OperatorIncrementPrefix )
+{
+    CF::String                       s( "a,b" );
+    CF::String::SplitRange           r( s.Split( "," ) );
+    CF::String::SplitRange::Iterator i( r.begin() );
+    
+    ASSERT_EQ( ( ++i )->GetValue(), "b" );
+    ASSERT_TRUE( ++i == r.end() );
+}
+
+TEST( CFPP_String_SplitRange_Iterator, OperatorIncrementPostfix )
+{
+    CF::String                       s( "a,b" );
+    CF::String::SplitRange           r( s.Split( "," ) );
+    CF::String::SplitRange::Iterator i( r.begin() );
+    
+    ASSERT_EQ( ( i++ )->GetValue(), "a" );
+    ASSERT_EQ( ( i++ )->GetValue(), "b" );
+    ASSERT_TRUE( i == r.end() );
+}
+
+TEST( CFPP_String_SplitRange_Iterator, OperatorEqual )
+{
+    CF::String             s( "a,b" );
+    CF::String::SplitRange r( s.Split( "," ) );
+    
+    ASSERT_TRUE(  r.begin() == r.begin() );
+    ASSERT_FALSE( r.begin() == r.end() );
+}
+
+TEST( CFPP_String_SplitRange_Iterator, OperatorNotEqual )
+{
+    CF::String             s( "a,b" );
+    CF::String::SplitRange r( s.Split( "," ) );
+    
+    ASSERT_FALSE( r.begin() != r.begin() );
+    ASSERT_TRUE(  r.begin() != r.end() );
+}
+
+TEST( CFPP_String_SplitRange_Iterator, OperatorDereference )
+{
+    CF::String             s( "a,b" );
+    CF::String::SplitRange r( s.Split( "," ) );
+    
+    ASSERT_EQ( ( *( r.begin() ) ).GetValue(), "a" );
+    ASSERT_EQ( r.begin()->GetValue(),         "a" );
+}
+
+TEST( CFPP_String_SplitRange_Iterator, OutlivesRange )
+{
+    CF::String                       s( "h\xC3\xA9llo,world" );
+    CF::String::SplitRange::Iterator i( s.Split( "," ).begin() );
+    
+    s = "other";
+    
+    ASSERT_EQ( ( i++ )->GetValue(), "h\xC3\xA9llo" );
+    ASSERT_EQ( ( i++ )->GetValue(), "world" );
+    ASSERT_TRUE( i->GetBytes() == nullptr );
+}
+
+TEST( CFPP_String_SplitRange_Iterator, Swap )
+{
+    CF::String                       s( "a,b" );
+    CF::String::SplitRange           r( s.Split( "," ) );
+    CF::String::SplitRange::Iterator i1( r.begin() );
+    CF::String::SplitRange::Iterator i2( r.end() );
+    
+    swap( i1, i2 );
+    
+    ASSERT_TRUE( i1 == r.end() );
+    ASSERT_EQ( i2->GetValue(), "a" );
+}
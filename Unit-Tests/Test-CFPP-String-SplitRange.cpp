@@ -0,0 +1,121 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        Test-CFPP-String-SplitRange.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Unit tests for CF::String::SplitRange
+ */
+
+#include <CF++.hpp>
+
+#define XSTEST_GTEST_COMPAT
+#include <XSTest/XSTest.hpp>
+
+TEST( CFPP_String_SplitRange, CCTOR )
+{
+    CF::String             s( "a,b" );
+    CF::String::SplitRange r1( s.Split( "," ) );
+    CF::String::SplitRange r2( r1 );
+    
+    ASSERT_EQ( std::distance( r2.begin(), r2.end() ), 2 );
+    ASSERT_EQ( r2.begin()->GetValue(), "a" );
+}
+
+TEST( CFPP_String_SplitRange, MCTOR )
+{
+    CF::String             s( "a,b" );
+    CF::String::SplitRange r1( s.Split( "," ) );
+    CF::String::SplitRange r2( std::move( r1 ) );
+    
+    ASSERT_EQ( std::distance( r2.begin(), r2.end() ), 2 );
+    ASSERT_TRUE( r1.begin() == r1.end() );
+}
+
+TEST( CFPP_String_SplitRange, OperatorAssign )
+{
+    CF::String             s1( "a,b" );
+    CF::String             s2( "c,d,e" );
+    CF::String::SplitRange r1( s1.Split( "," ) );
+    CF::String::SplitRange r2( s2.Split( "," ) );
+    
+    r1 = r2;
+    
+    ASSERT_EQ( std::distance( r1.begin(), r1.end() ), 3 );
+    ASSERT_EQ( r1.begin()->GetValue(), "c" );
+}
+
+TEST( CFPP_String_SplitRange, OutlivesString )
+{
+    CF::String             s( "h\xC3\xA9llo,world" );
+    CF::String::SplitRange r( s.Split( "," ) );
+    
+    s = "other";
+    
+    ASSERT_EQ( r.begin()->GetValue(), "h\xC3\xA9llo" );
+}
+
+TEST( CFPP_String_SplitRange, Begin )
+{
+    CF::String             s1;
+    CF::String             s2( static_cast< CFStringRef >( nullptr ) );
+    CF::String             s3( "a,b" );
+    CF::String::SplitRange r1( s1.Split( "," ) );
+    CF::String::SplitRange r2( s2.Split( "," ) );
+    CF::String::SplitRange r3( s3.Split( "," ) );
+    
+    ASSERT_TRUE( r1.begin() != r1.end() );
+    ASSERT_TRUE( r2.begin() == r2.end() );
+    ASSERT_TRUE( r3.begin() != r3.end() );
+    
+    ASSERT_EQ( r1.begin()->GetValue(), "" );
+    ASSERT_EQ( r3.begin()->GetValue(), "a" );
+}
+
+TEST( CFPP_String_SplitRange, End )
+{
+    CF::String             s( "a,b" );
+    CF::String::SplitRange r( s.Split( "," ) );
+    auto                   i( r.begin() );
+    
+    ++i;
+    ++i;
+    
+    ASSERT_TRUE( i == r.end() );
+    ASSERT_TRUE( ++i == r.end() );
+    ASSERT_EQ( r.end()->GetLength(), 0 );
+}
+
+TEST( CFPP_String_SplitRange, Swap )
+{
+    CF::String             s1( "a,b" );
+    CF::String             s2( "c,d,e" );
+    CF::String::SplitRange r1( s1.Split( "," ) );
+    CF::String::SplitRange r2( s2.Split( "," ) );
+    
+    swap( r1, r2 );
+    
+    ASSERT_EQ( std::distance( r1.begin(), r1.end() ), 3 );
+    ASSERT_EQ( std::distance( r2.begin(), r2.end() ), 2 );
+}
@@ -0,0 +1,160 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        Test-CFPP-String-Token.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Unit tests for CF::String::Token
+ */
+
+#include <CF++.hpp>
+
+#define XSTEST_GTEST_COMPAT
+#include <XSTest/XSTest.hpp>
+
+TEST( CFPP_String_Token, CTOR )
+{
+    CF::String::Token t;
+    
+    ASSERT_TRUE( t.GetBytes() == nullptr );
+    ASSERT_EQ( t.GetLength(), 0 );
+    ASSERT_EQ( t.GetValue(),  "" );
+}
+
+TEST( CFPP_String_Token, CCTOR )
+{
+    CF::String        s( "hello,world" );
+    CF::String::Token t1( *( s.Split( "," ).begin() ) );
+    CF::String::Token t2( t1 );
+    
+    ASSERT_EQ( t2.GetValue(), "hello" );
+    ASSERT_TRUE( t1.GetBytes() == t2.GetBytes() );
+}
+
+TEST( CFPP_String_Token, OperatorAssign )
+{
+    CF::String        s( "hello,world" );
+    CF::String::Token t;
+    
+    t = *( s.Split( "," ).begin() );
+    
+    ASSERT_EQ( t.GetValue(), "hello" );
+}
+
+TEST( CFPP_String_Token, OperatorEqual )
+{
+    CF::String             s( "a,b,a" );
+    CF::String::SplitRange r( s.Split( "," ) );
+    auto                   i( r.begin() );
+    CF::String::Token      t1( *( i++ ) );
+    CF::String::Token      t2( *( i++ ) );
+    CF::String::Token      t3( *( i++ ) );
+    
+    ASSERT_TRUE(  t1 == t3 );
+    ASSERT_FALSE( t1 == t2 );
+    ASSERT_TRUE(  t1 == "a" );
+    ASSERT_TRUE(  t1 == std::string( "a" ) );
+    ASSERT_FALSE( t1 == "ab" );
+    ASSERT_TRUE(  CF::String::Token() == static_cast< const char * >( nullptr ) );
+}
+
+TEST( CFPP_String_Token, OperatorNotEqual )
+{
+    CF::String             s( "a,b,a" );
+    CF::String::SplitRange r( s.Split( "," ) );
+    auto                   i( r.begin() );
+    CF::String::Token      t1( *( i++ ) );
+    CF::String::Token      t2( *( i++ ) );
+    
+    ASSERT_TRUE(  t1 != t2 );
+    ASSERT_FALSE( t1 != "a" );
+    ASSERT_TRUE(  t1 != std::string( "b" ) );
+}
+
+TEST( CFPP_String_Token, GetBytes )
+{
+    CF::String             s( "hello,world" );
+    CF::String::SplitRange r( s.Split( "," ) );
+    
+    ASSERT_EQ( strncmp( r.begin()->GetBytes(), "hello", 5 ), 0 );
+}
+
+TEST( CFPP_String_Token, GetLength )
+{
+    CF::String             s( "hello,,world" );
+    CF::String::SplitRange r( s.Split( "," ) );
+    auto                   i( r.begin() );
+    
+    ASSERT_EQ( ( i++ )->GetLength(), 5 );
+    ASSERT_EQ( ( i++ )->GetLength(), 0 );
+    ASSERT_EQ( ( i++ )->GetLength(), 5 );
+}
+
+TEST( CFPP_String_Token, GetValue )
+{
+    CF::String             s( "h\xC3\xA9llo,w\xC3\xB6rld" );
+    CF::String::SplitRange r( s.Split( "," ) );
+    auto                   i( r.begin() );
+    
+    ASSERT_EQ( ( i++ )->GetValue(), "h\xC3\xA9llo" );
+    ASSERT_EQ( ( i++ )->GetValue(), "w\xC3\xB6rld" );
+}
+
+TEST( CFPP_String_Token, GetString )
+{
+    CF::String             s( "h\xC3\xA9llo,world" );
+    CF::String::SplitRange r( s.Split( "," ) );
+    CF::String             t( r.begin()->GetString() );
+    
+    ASSERT_TRUE( t.IsValid() );
+    ASSERT_EQ( t.GetLength(), 5 );
+    ASSERT_EQ( t,             "h\xC3\xA9llo" );
+    ASSERT_FALSE( CF::String::Token().GetString().IsValid() );
+}
+
+#if __cplusplus >= 201703L
+TEST( CFPP_String_Token, GetView )
+{
+    CF::String             s( "hello,world" );
+    CF::String::SplitRange r( s.Split( "," ) );
+    
+    ASSERT_TRUE( r.begin()->GetView() == "hello" );
+    ASSERT_TRUE( r.begin()->GetView().data() == r.begin()->GetBytes() );
+    ASSERT_TRUE( CF::String::Token().GetView().empty() );
+}
+#endif
+
+TEST( CFPP_String_Token, Swap )
+{
+    CF::String             s( "hello,world" );
+    CF::String::SplitRange r( s.Split( "," ) );
+    auto                   i( r.begin() );
+    CF::String::Token      t1( *( i++ ) );
+    CF::String::Token      t2( *( i++ ) );
+    
+    swap( t1, t2 );
+    
+    ASSERT_EQ( t1.GetValue(), "world" );
+    ASSERT_EQ( t2.GetValue(), "hello" );
+}
@@ -29,6 +29,7 @@
  */
 
 #include <CF++.hpp>
+#include <thread>
 
 #define XSTEST_GTEST_COMPAT
 #include <XSTest/XSTest.hpp>
@@ -353,6 +354,23 @@ TEST( CFPP_String, OperatorEqualCChar )
     ASSERT_FALSE( CF::String( "hello, world" ) == static_cast< const char * >( nullptr ) );
 }
 
+TEST( CFPP_String, OperatorEqualCChar_UTF8 )
+{
+    UniChar    chars[] = { 'h', 0xE9, 'l', 'l', 'o', ' ', 0xD83D, 0xDE00 };
+    CF::String s1( CF::AutoPointer( CFStringCreateWithCharacters( nullptr, chars, 8 ) ) );
+    CF::String s2( "h\xC3\xA9llo \xF0\x9F\x98\x80" );
+    CF::String s3( "hello" );
+    
+    ASSERT_TRUE(  s1 == "h\xC3\xA9llo \xF0\x9F\x98\x80" );
+    ASSERT_TRUE(  s2 == "h\xC3\xA9llo \xF0\x9F\x98\x80" );
+    ASSERT_FALSE( s1 == "h\xC3\xA9llo \xF0\x9F\x98\x81" );
+    ASSERT_FALSE( s1 == "h\xC3\xA9llo" );
+    ASSERT_FALSE( s1 == "h\xC3" );
+    ASSERT_TRUE(  s3 == std::string( "hello" ) );
+    ASSERT_FALSE( s3 == std::string( "hello\0", 6 ) );
+    ASSERT_FALSE( s3 == "h\xC3\xA9llo" );
+}
+
 TEST( CFPP_String, OperatorNotEqualString )
 {
     ASSERT_FALSE( CF::String( "hello, world" ) != CF::String( "hello, world" ) );
@@ -481,6 +499,69 @@ TEST( CFPP_String, OperatorPlusEqualCChar )
     ASSERT_TRUE( s.GetValue() == "hello, world..." );
 }
 
+TEST( CFPP_String, OperatorPlusEqualSelf )
+{
+    CF::String s( "abc" );
+    
+    s += s;
+    
+    ASSERT_TRUE( s.GetValue() == "abcabc" );
+    
+    s += s;
+    
+    ASSERT_TRUE( s.GetValue() == "abcabcabcabc" );
+}
+
+TEST( CFPP_String, OperatorPlusEqualCopy )
+{
+    CF::String s1( "hello" );
+    CF::String s2;
+    
+    s1 += ", ";
+    s2  = s1;
+    s1 += "world";
+    s2 += "universe";
+    
+    ASSERT_TRUE( s1.GetValue() == "hello, world" );
+    ASSERT_TRUE( s2.GetValue() == "hello, universe" );
+}
+
+TEST( CFPP_String, OperatorPlusEqualMany )
+{
+    CF::String  s;
+    std::string expected;
+    
+    for( int i = 0; i < 10000; i++ )
+    {
+        s        += "abc-";
+        expected += "abc-";
+    }
+    
+    ASSERT_EQ( s.GetLength(), 40000 );
+    ASSERT_EQ( s.GetValue(),  expected );
+    ASSERT_TRUE( CFStringCompare( static_cast< CFStringRef >( s.GetCFObject() ), CF::String( expected ), 0 ) == kCFCompareEqualTo );
+}
+
+TEST( CFPP_String, OperatorPlusEqualRetainedObject )
+{
+    CF::String  s( "hello" );
+    CFStringRef o;
+    
+    s += ", world";
+    o  = static_cast< CFStringRef >( CFRetain( s.GetCFObject() ) );
+    
+    ASSERT_TRUE( s.IsValid() );
+    ASSERT_TRUE( s.GetCFObject() == o );
+    
+    s += ", and universe";
+    
+    ASSERT_EQ( s.GetValue(),               "hello, world, and universe" );
+    ASSERT_EQ( CF::String( o ).GetValue(), "hello, world" );
+    ASSERT_TRUE( s.GetCFObject() != o );
+    
+    CFRelease( o );
+}
+
 TEST( CFPP_String, OperatorSubscript )
 {
     CF::String s( "hello, world" );
@@ -512,6 +593,24 @@ TEST( CFPP_String, OperatorSubscript )
     ASSERT_EQ( s[ -11 ], 0 );
 }
 
+TEST( CFPP_String, OperatorSubscript_UTF8 )
+{
+    CF::String s( "h\xC3\xA9llo" );
+    
+    ASSERT_EQ( s[  0 ], 'h' );
+    ASSERT_EQ( s[  1 ], '\xC3' );
+    ASSERT_EQ( s[  2 ], '\xA9' );
+    ASSERT_EQ( s[  5 ], 'o' );
+    ASSERT_EQ( s[ -1 ], 'o' );
+    ASSERT_EQ( s[ -6 ], 'h' );
+    ASSERT_EQ( s[  6 ], 0 );
+    
+    s += "!";
+    
+    ASSERT_EQ( s[  6 ], '!' );
+    ASSERT_EQ( s[ -1 ], '!' );
+}
+
 TEST( CFPP_String, CastToSTDString )
 {
     std::string s1( "hello, world" );
@@ -579,6 +678,18 @@ TEST( CFPP_String, HasPrefix_STDString )
     ASSERT_FALSE( s2.HasPrefix( std::string( "world" ) ) );
 }
 
+TEST( CFPP_String, HasPrefix_STDString_UTF8 )
+{
+    UniChar    chars[] = { 'h', 0xE9, 'l', 'l', 'o', ' ', 0xD83D, 0xDE00 };
+    CF::String s( CF::AutoPointer( CFStringCreateWithCharacters( nullptr, chars, 8 ) ) );
+    
+    ASSERT_TRUE(  s.HasPrefix( std::string( "h\xC3\xA9" ) ) );
+    ASSERT_TRUE(  s.HasPrefix( std::string( "h\xC3\xA9llo \xF0\x9F\x98\x80" ) ) );
+    ASSERT_FALSE( s.HasPrefix( std::string( "h\xC3\xA9llo \xF0\x9F\x98\x80!" ) ) );
+    ASSERT_FALSE( s.HasPrefix( std::string( "he" ) ) );
+    ASSERT_FALSE( s.HasPrefix( std::string( "h\xC3" ) ) );
+}
+
 TEST( CFPP_String, HasSuffix_String )
 {
     CF::String s1;
@@ -617,6 +728,18 @@ TEST( CFPP_String, HasSuffix_STDString )
     ASSERT_FALSE( s2.HasSuffix( std::string( "universe" ) ) );
 }
 
+TEST( CFPP_String, HasSuffix_STDString_UTF8 )
+{
+    UniChar    chars[] = { 'h', 0xE9, 'l', 'l', 'o', ' ', 0xD83D, 0xDE00 };
+    CF::String s( CF::AutoPointer( CFStringCreateWithCharacters( nullptr, chars, 8 ) ) );
+    
+    ASSERT_TRUE(  s.HasSuffix( std::string( " \xF0\x9F\x98\x80" ) ) );
+    ASSERT_TRUE(  s.HasSuffix( std::string( "h\xC3\xA9llo \xF0\x9F\x98\x80" ) ) );
+    ASSERT_FALSE( s.HasSuffix( std::string( "!h\xC3\xA9llo \xF0\x9F\x98\x80" ) ) );
+    ASSERT_FALSE( s.HasSuffix( std::string( "\x98\x80" ) ) );
+    ASSERT_FALSE( s.HasSuffix( std::string( "o" ) ) );
+}
+
 TEST( CFPP_String, GetLength )
 {
     CF::String s;
@@ -653,6 +776,119 @@ TEST( CFPP_String, GetValue )
     ASSERT_EQ( s.GetValue(), "" );
 }
 
+TEST( CFPP_String, GetValue_STDString )
+{
+    CF::String  s1( "hello, world" );
+    CF::String  s2( "h\xC3\xA9llo, w\xC3\xB6rld" );
+    std::string str;
+    
+    str.reserve( 64 );
+    s1.GetValue( str );
+    
+    ASSERT_EQ( str, "hello, world" );
+    ASSERT_GE( str.capacity(), 64 );
+    
+    s2.GetValue( str );
+    
+    ASSERT_EQ( str, "h\xC3\xA9llo, w\xC3\xB6rld" );
+    ASSERT_GE( str.capacity(), 64 );
+    
+    s2.GetValue( str, kCFStringEncodingISOLatin1 );
+    
+    ASSERT_EQ( str, "h\xE9llo, w\xF6rld" );
+    
+    s2.GetValue( str, kCFStringEncodingASCII );
+    
+    ASSERT_EQ( str, "" );
+    
+    s1 = static_cast< CFStringRef >( nullptr );
+    
+    s1.GetValue( str );
+    
+    ASSERT_EQ( str, "" );
+}
+
+#if __cplusplus >= 201703L
+TEST( CFPP_String, GetView )
+{
+    CF::String s1( "hello, world" );
+    CF::String s2( "h\xC3\xA9llo, w\xC3\xB6rld" );
+    CF::String s3;
+    
+    ASSERT_TRUE( s1.GetView() == "hello, world" );
+    ASSERT_TRUE( s2.GetView() == "h\xC3\xA9llo, w\xC3\xB6rld" );
+    ASSERT_TRUE( s2.GetView( kCFStringEncodingISOLatin1 ) == "h\xE9llo, w\xF6rld" );
+    ASSERT_TRUE( s2.GetView().data() == s2.GetView().data() );
+    ASSERT_TRUE( s3.GetView().empty() );
+    
+    s2 += "!";
+    
+    ASSERT_TRUE( s2.GetView() == "h\xC3\xA9llo, w\xC3\xB6rld!" );
+    
+    s3 = static_cast< CFStringRef >( nullptr );
+    
+    ASSERT_TRUE( s3.GetView().empty() );
+}
+
+TEST( CFPP_String, GetViewEncodings )
+{
+    CF::String       s( "h\xC3\xA9llo, w\xC3\xB6rld" );
+    std::string_view v1;
+    std::string_view v2;
+    std::string_view v3;
+    
+    v1 = s.GetView();
+    v2 = s.GetView( kCFStringEncodingISOLatin1 );
+    v3 = s.GetView( kCFStringEncodingUTF16 );
+    
+    ASSERT_TRUE( v1 == "h\xC3\xA9llo, w\xC3\xB6rld" );
+    ASSERT_TRUE( v2 == "h\xE9llo, w\xF6rld" );
+    ASSERT_EQ( v3.size(), 24 );
+    ASSERT_TRUE( s.GetView().data() == v1.data() );
+    ASSERT_TRUE( s.GetView( kCFStringEncodingISOLatin1 ).data() == v2.data() );
+}
+
+TEST( CFPP_String, GetViewConcurrent )
+{
+    const CF::String           s( "h\xC3\xA9llo, w\xC3\xB6rld" );
+    std::vector< std::thread > threads;
+    std::atomic< int >         failures( 0 );
+    
+    for( int i = 0; i < 8; i++ )
+    {
+        threads.push_back
+        (
+            std::thread
+            (
+                [ &, i ]
+                {
+                    CFStringEncoding encoding;
+                    std::string      expected;
+                    
+                    encoding = ( i % 2 == 0 ) ? kCFStringEncodingUTF8 : kCFStringEncodingISOLatin1;
+                    expected = ( i % 2 == 0 ) ? "h\xC3\xA9llo, w\xC3\xB6rld" : "h\xE9llo, w\xF6rld";
+                    
+                    for( int j = 0; j < 1000; j++ )
+                    {
+                        if( s.GetView( encoding ) != expected )
+                        {
+                            failures++;
+                        }
+                    }
+                }
+            )
+        );
+    }
+    
+    for( auto & t: threads )
+    {
+        t.join();
+    }
+    
+    ASSERT_EQ( failures.load(), 0 );
+}
+#endif
+
 TEST( CFPP_String, GetCStringValue )
 {
     const char * p;
@@ -679,6 +915,267 @@ TEST( CFPP_String, SetValue )
     ASSERT_EQ( s.GetValue(), "hello, universe" );
 }
 
+TEST( CFPP_String, SetValue_ASCII )
+{
+    CF::String  s;
+    std::string ascii( 1000, 'a' );
+    std::string utf8( ascii + "\xC3\xA9" );
+    
+    s.SetValue( ascii );
+    
+    ASSERT_EQ( s.GetLength(), 1000 );
+    ASSERT_EQ( s.GetValue(),  ascii );
+    
+    s.SetValue( utf8 );
+    
+    ASSERT_EQ( s.GetLength(), 1001 );
+    ASSERT_EQ( s.GetValue(),  utf8 );
+    
+    s.SetValue( ascii, kCFStringEncodingASCII );
+    
+    ASSERT_EQ( s.GetValue(), ascii );
+    
+    s.SetValue( std::string( "hello\0world", 11 ) );
+    
+    ASSERT_EQ( s.GetValue(), "hello" );
+}
+
+TEST( CFPP_String, GetValue_Mutable )
+{
+    CF::String  s1( "hello" );
+    CF::String  s2( "h\xC3\xA9llo" );
+    std::string ascii( 1000, 'a' );
+    
+    s1 += ascii;
+    s2 += ascii;
+    
+    ASSERT_EQ( s1.GetValue(),                         "hello" + ascii );
+    ASSERT_EQ( s1.GetValue( kCFStringEncodingASCII ), "hello" + ascii );
+    ASSERT_EQ( s2.GetValue(),                         "h\xC3\xA9llo" + ascii );
+    ASSERT_EQ( s2.GetValue( kCFStringEncodingASCII ), "" );
+}
+
+TEST( CFPP_String, Reserve )
+{
+    CF::String s( "hello" );
+    CF::String s2;
+    
+    s.Reserve( 1024 );
+    
+    ASSERT_TRUE( s.IsValid() );
+    ASSERT_EQ( s.GetLength(), 5 );
+    ASSERT_EQ( s.GetValue(),  "hello" );
+    
+    s += ", world";
+    
+    ASSERT_EQ( s.GetValue(), "hello, world" );
+    
+    s.Reserve( 0 );
+    
+    ASSERT_EQ( s.GetValue(), "hello, world" );
+    
+    s2 = static_cast< CFStringRef >( nullptr );
+    
+    s2.Reserve( 16 );
+    
+    ASSERT_TRUE( s2.IsValid() );
+    ASSERT_EQ( s2.GetValue(), "" );
+}
+
+TEST( CFPP_String, Reserve_Shared )
+{
+    CF::String  s( std::string( 64, 'a' ) );
+    CFStringRef o;
+    
+    s += "b";
+    
+    {
+        CF::String s2( s );
+        
+        s.Reserve( 0 );
+        
+        ASSERT_EQ( s.GetLength(),  65 );
+        ASSERT_EQ( s2.GetLength(), 65 );
+        ASSERT_EQ( s.GetValue(),   s2.GetValue() );
+        
+        s += "c";
+        
+        ASSERT_EQ( s.GetLength(),  66 );
+        ASSERT_EQ( s2.GetLength(), 65 );
+    }
+    
+    s += "d";
+    
+    ASSERT_EQ( s.GetValue(), std::string( 64, 'a' ) + "bcd" );
+    
+    o = static_cast< CFStringRef >( CFRetain( s.GetCFObject() ) );
+    
+    s.Reserve( 0 );
+    
+    ASSERT_EQ( s.GetLength(),              67 );
+    ASSERT_EQ( CF::String( o ).GetValue(), s.GetValue() );
+    
+    CFRelease( o );
+}
+
+TEST( CFPP_String, SmallString )
+{
+    CF::String s1( "hello" );
+    CF::String s2( s1 );
+    CF::String s3( std::string( 15, 'a' ) );
+    CF::String s4( std::string( 16, 'a' ) );
+    CFTypeRef  o;
+    
+    ASSERT_EQ( s1.GetLength(), 5 );
+    ASSERT_EQ( s1, "hello" );
+    ASSERT_EQ( s1, s2 );
+    ASSERT_EQ( s1[ 1 ], 'e' );
+    ASSERT_EQ( strcmp( s1.GetCStringValue(), "hello" ), 0 );
+    ASSERT_EQ( s3.GetValue(), std::string( 15, 'a' ) );
+    ASSERT_EQ( s4.GetValue(), std::string( 16, 'a' ) );
+    
+    o = s1.GetCFObject();
+    
+    ASSERT_TRUE( o != nullptr );
+    ASSERT_TRUE( s1.GetCFObject() == o );
+    ASSERT_TRUE( CF::String( s1 ).GetCFObject() == o );
+    ASSERT_TRUE( CFEqual( o, CFSTR( "hello" ) ) );
+    ASSERT_EQ( s1, s2 );
+    
+    s2 += ", world";
+    
+    ASSERT_EQ( s1, "hello" );
+    ASSERT_EQ( s2, "hello, world" );
+    ASSERT_TRUE( CFEqual( s2.GetCFObject(), CFSTR( "hello, world" ) ) );
+    
+    s1 = "h\xC3\xA9llo";
+    
+    ASSERT_EQ( s1.GetLength(), 5 );
+    ASSERT_EQ( s1.GetValue(),  "h\xC3\xA9llo" );
+}
+
+TEST( CFPP_String, SmallStringConcurrent )
+{
+    const CF::String           s( "hello" );
+    std::vector< std::thread > threads;
+    std::vector< CFTypeRef >   objects( 8, nullptr );
+    
+    for( size_t i = 0; i < objects.size(); i++ )
+    {
+        threads.push_back
+        (
+            std::thread
+            (
+                [ &, i ]
+                {
+                    objects[ i ] = s.GetCFObject();
+                }
+            )
+        );
+    }
+    
+    for( auto & t: threads )
+    {
+        t.join();
+    }
+    
+    for( CFTypeRef o: objects )
+    {
+        ASSERT_TRUE( o != nullptr );
+        ASSERT_TRUE( o == s.GetCFObject() );
+    }
+}
+
+TEST( CFPP_String, Split )
+{
+    CF::String                 s1( "a,,b,c" );
+    CF::String                 s2( "h\xC3\xA9llo::w\xC3\xB6rld::" );
+    CF::String                 s3( "hello" );
+    std::vector< std::string > v;
+    
+    for( const CF::String::Token & t: s1.Split( "," ) )
+    {
+        v.push_back( t.GetValue() );
+    }
+    
+    ASSERT_EQ( v.size(), 4 );
+    ASSERT_EQ( v[ 0 ], "a" );
+    ASSERT_EQ( v[ 1 ], "" );
+    ASSERT_EQ( v[ 2 ], "b" );
+    ASSERT_EQ( v[ 3 ], "c" );
+    
+    v.clear();
+    
+    for( const CF::String::Token & t: s2.Split( "::" ) )
+    {
+        v.push_back( t.GetValue() );
+    }
+    
+    ASSERT_EQ( v.size(), 3 );
+    ASSERT_EQ( v[ 0 ], "h\xC3\xA9llo" );
+    ASSERT_EQ( v[ 1 ], "w\xC3\xB6rld" );
+    ASSERT_EQ( v[ 2 ], "" );
+    
+    v.clear();
+    
+    for( const CF::String::Token & t: s3.Split( "" ) )
+    {
+        v.push_back( t.GetValue() );
+    }
+    
+    ASSERT_EQ( v.size(), 1 );
+    ASSERT_EQ( v[ 0 ], "hello" );
+}
+
+TEST( CFPP_String, Intern )
+{
+    CF::String s1( "interned-key" );
+    CF::String s2( std::string( "interned-key" ) );
+    CF::String s3( "interned-other" );
+    CF::String s4( static_cast< CFStringRef >( nullptr ) );
+    
+    ASSERT_NE( s1.GetCFObject(), s2.GetCFObject() );
+    
+    ASSERT_EQ( s1.Intern().GetCFObject(), s2.Intern().GetCFObject() );
+    ASSERT_NE( s1.Intern().GetCFObject(), s3.Intern().GetCFObject() );
+    ASSERT_EQ( s1.Intern(), s2.Intern() );
+    ASSERT_EQ( s1.Intern().GetValue(), "interned-key" );
+    
+    s1 += "-appended";
+    
+    ASSERT_EQ( s1.Intern().GetValue(), "interned-key-appended" );
+    ASSERT_NE( s1.Intern().GetCFObject(), s2.Intern().GetCFObject() );
+    
+    ASSERT_FALSE( s4.Intern().IsValid() );
+}
+
+TEST( CFPP_String, GetInternHitCount )
+{
+    CFIndex    hits;
+    CF::String s( "interned-hit" );
+    
+    s.Intern();
+    
+    hits = CF::String::GetInternHitCount();
+    
+    s.Intern();
+    CF::String( "interned-hit" ).Intern();
+    
+    ASSERT_GE( CF::String::GetInternHitCount(), hits + 2 );
+}
+
+TEST( CFPP_String, GetInternMissCount )
+{
+    CFIndex    misses;
+    CF::String s( "interned-miss" );
+    
+    misses = CF::String::GetInternMissCount();
+    
+    s.Intern();
+    
+    ASSERT_GE( CF::String::GetInternMissCount(), misses + 1 );
+}
+
 TEST( CFPP_String, Swap )
 {
     CF::String s1( "hello, world" );
@@ -0,0 +1,258 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        Test-CFPP-StringBuilder.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Unit tests for CF::StringBuilder
+ */
+
+#include <CF++.hpp>
+
+#define XSTEST_GTEST_COMPAT
+#include <XSTest/XSTest.hpp>
+
+TEST( CFPP_StringBuilder, CTOR )
+{
+    CF::StringBuilder b;
+    
+    ASSERT_EQ( b.GetLength(), 0 );
+    ASSERT_TRUE( b.GetString().IsValid() );
+    ASSERT_EQ( b.GetString(), "" );
+}
+
+TEST( CFPP_StringBuilder, CTOR_Capacity )
+{
+    CF::StringBuilder b( 1024 );
+    
+    ASSERT_EQ( b.GetLength(), 0 );
+    
+    b << "hello";
+    
+    ASSERT_EQ( b.GetString(), "hello" );
+}
+
+TEST( CFPP_StringBuilder, CCTOR )
+{
+    CF::StringBuilder b1;
+    
+    b1 << "hello";
+    
+    {
+        CF::StringBuilder b2( b1 );
+        
+        b2 << ", world";
+        
+        ASSERT_EQ( b1.GetString(), "hello" );
+        ASSERT_EQ( b2.GetString(), "hello, world" );
+    }
+}
+
+TEST( CFPP_StringBuilder, MCTOR )
+{
+    CF::StringBuilder b1;
+    
+    b1 << "hello";
+    
+    {
+        CF::StringBuilder b2( std::move( b1 ) );
+        
+        ASSERT_EQ( b2.GetString(), "hello" );
+    }
+}
+
+TEST( CFPP_StringBuilder, OperatorAssign )
+{
+    CF::StringBuilder b1;
+    CF::StringBuilder b2;
+    
+    b1 << "hello";
+    b2 = b1;
+    
+    ASSERT_EQ( b2.GetString(), "hello" );
+}
+
+TEST( CFPP_StringBuilder, OperatorShiftString )
+{
+    CF::StringBuilder b;
+    
+    b << CF::String( "hello" ) << CF::String( static_cast< CFStringRef >( nullptr ) ) << static_cast< CFStringRef >( CF::String( ", world" ).GetCFObject() );
+    
+    ASSERT_EQ( b.GetString(), "hello, world" );
+}
+
+TEST( CFPP_StringBuilder, OperatorShiftUTF8 )
+{
+    CF::StringBuilder b;
+    std::string       s( 1000, 'a' );
+    
+    b << "h\xC3\xA9llo" << std::string( ", " ) << static_cast< const char * >( nullptr ) << 'w' << "\xC3\xB6rld";
+    
+    ASSERT_EQ( b.GetLength(),  12 );
+    ASSERT_EQ( b.GetString(), "h\xC3\xA9llo, w\xC3\xB6rld" );
+    
+    b.Clear();
+    b << s;
+    
+    ASSERT_EQ( b.GetString(), s );
+}
+
+TEST( CFPP_StringBuilder, OperatorShiftInteger )
+{
+    CF::StringBuilder b;
+    
+    b << 0 << ' ' << -42 << ' ' << 42L << ' ' << static_cast< signed long long >( INT64_MIN ) << ' ' << 7U << ' ' << 8UL << ' ' << static_cast< unsigned long long >( UINT64_MAX );
+    
+    ASSERT_EQ( b.GetString(), "0 -42 42 -9223372036854775808 7 8 18446744073709551615" );
+}
+
+TEST( CFPP_StringBuilder, OperatorShiftBool )
+{
+    CF::StringBuilder b;
+    
+    b << true << ' ' << false;
+    
+    ASSERT_EQ( b.GetString(), "true false" );
+}
+
+TEST( CFPP_StringBuilder, OperatorShiftDouble )
+{
+    CF::StringBuilder b;
+    double            d;
+    
+    b << 0.1 << ' ' << -2.5 << ' ' << 1e100;
+    
+    ASSERT_EQ( b.GetString(), "0.1 -2.5 1e+100" );
+    
+    b.Clear();
+    b << 1.0 / 3.0;
+    
+    d = strtod( b.GetString().GetValue().c_str(), nullptr );
+    
+    ASSERT_TRUE( d == 1.0 / 3.0 );
+}
+
+TEST( CFPP_StringBuilder, OperatorShiftNumber )
+{
+    CF::StringBuilder b;
+    
+    b << CF::Number( 42 ) << ' ' << CF::Number( 1.5 ) << CF::Number( static_cast< CFNumberRef >( nullptr ) );
+    
+    ASSERT_EQ( b.GetString(), "42 1.5" );
+}
+
+TEST( CFPP_StringBuilder, OperatorShiftDate )
+{
+    CF::StringBuilder b;
+    
+    b << CF::Date( 0.0 ) << ' ' << CF::Date( -1.0 ) << ' ' << CF::Date( 1000000000.0 ) << CF::Date( static_cast< CFDateRef >( nullptr ) );
+    
+    ASSERT_EQ( b.GetString(), "2001-01-01T00:00:00Z 2000-12-31T23:59:59Z 2032-09-09T01:46:40Z" );
+}
+
+TEST( CFPP_StringBuilder, Append )
+{
+    CF::StringBuilder b;
+    
+    b.Append( "hello, world", 5 ).Append( nullptr, 10 ).Append( "h\xC3\xA9", 3 );
+    
+    ASSERT_EQ( b.GetString(), "helloh\xC3\xA9" );
+}
+
+TEST( CFPP_StringBuilder, Append_InvalidUTF8 )
+{
+    CF::StringBuilder b;
+    
+    b << "hello";
+    b.Append( ", world\xC3\x28", 9 );
+    
+    ASSERT_EQ( b.GetLength(),  5 );
+    ASSERT_EQ( b.GetString(), "hello" );
+    
+    b.Append( ", w\xC3\xB6rld", 8 );
+    
+    ASSERT_EQ( b.GetString(), "hello, w\xC3\xB6rld" );
+}
+
+TEST( CFPP_StringBuilder, GetLength )
+{
+    CF::StringBuilder b;
+    
+    b << "h\xC3\xA9llo";
+    
+    ASSERT_EQ( b.GetLength(), 5 );
+}
+
+TEST( CFPP_StringBuilder, GetString )
+{
+    CF::StringBuilder b;
+    CF::String        s;
+    
+    b << "hello";
+    
+    s = b.GetString();
+    
+    b << ", world";
+    
+    ASSERT_EQ( s,             "hello" );
+    ASSERT_EQ( b.GetString(), "hello, world" );
+}
+
+TEST( CFPP_StringBuilder, Reserve )
+{
+    CF::StringBuilder b;
+    
+    b << "hello";
+    b.Reserve( 4096 );
+    
+    ASSERT_EQ( b.GetString(), "hello" );
+}
+
+TEST( CFPP_StringBuilder, Clear )
+{
+    CF::StringBuilder b;
+    
+    b << "hello";
+    b.Clear();
+    
+    ASSERT_EQ( b.GetLength(), 0 );
+    
+    b << "world";
+    
+    ASSERT_EQ( b.GetString(), "world" );
+}
+
+TEST( CFPP_StringBuilder, Swap )
+{
+    CF::StringBuilder b1;
+    CF::StringBuilder b2;
+    
+    b1 << "hello";
+    b2 << "world";
+    
+    swap( b1, b2 );
+    
+    ASSERT_EQ( b1.GetString(), "world" );
+    ASSERT_EQ( b2.GetString(), "hello" );
+}
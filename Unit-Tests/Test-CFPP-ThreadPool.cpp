@@ -0,0 +1,131 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        Test-CFPP-ThreadPool.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Unit tests for CF::ThreadPool
+ */
+
+#include <CF++.hpp>
+
+#define XSTEST_GTEST_COMPAT
+#include <XSTest/XSTest.hpp>
+
+TEST( CFPP_ThreadPool, CTOR )
+{
+    CF::ThreadPool p1( 1 );
+    CF::ThreadPool p2( 4 );
+    CF::ThreadPool p3( 0 );
+    
+    ASSERT_EQ( p1.GetThreadCount(), 1 );
+    ASSERT_EQ( p2.GetThreadCount(), 4 );
+    ASSERT_EQ( p3.GetThreadCount(), 1 );
+}
+
+TEST( CFPP_ThreadPool, GetShared )
+{
+    ASSERT_TRUE( &( CF::ThreadPool::GetShared() ) == &( CF::ThreadPool::GetShared() ) );
+    ASSERT_GE( CF::ThreadPool::GetShared().GetThreadCount(), 1 );
+}
+
+TEST( CFPP_ThreadPool, Run )
+{
+    for( size_t threads: { 1, 2, 4, 8, 16 } )
+    {
+        CF::ThreadPool        p( threads );
+        std::vector< size_t > v( 1000, 0 );
+        
+        p.Run( v.size(), [ & ]( size_t i ) { v[ i ] = i + 1; } );
+        
+        for( size_t i = 0; i < v.size(); i++ )
+        {
+            ASSERT_EQ( v[ i ], i + 1 );
+        }
+    }
+}
+
+TEST( CFPP_ThreadPool, Run_Empty )
+{
+    CF::ThreadPool p( 4 );
+    size_t         n;
+    
+    n = 0;
+    
+    p.Run( 0, [ & ]( size_t i ) { ( void )i; n++; } );
+    p.Run( 10, nullptr );
+    
+    ASSERT_EQ( n, 0 );
+}
+
+TEST( CFPP_ThreadPool, Run_Nested )
+{
+    CF::ThreadPool        p( 4 );
+    std::atomic< size_t > n( 0 );
+    
+    p.Run
+    (
+        8,
+        [ & ]( size_t i )
+        {
+            ( void )i;
+            
+            p.Run( 8, [ & ]( size_t j ) { ( void )j; n++; } );
+        }
+    );
+    
+    ASSERT_EQ( n, 64 );
+}
+
+TEST( CFPP_ThreadPool, Run_Exception )
+{
+    CF::ThreadPool        p( 4 );
+    std::atomic< size_t > n( 0 );
+    
+    ASSERT_THROW
+    (
+        p.Run
+        (
+            1000,
+            [ & ]( size_t i )
+            {
+                if( i == 10 )
+                {
+                    throw std::runtime_error( "error" );
+                }
+                
+                n++;
+            }
+        ),
+        std::runtime_error
+    );
+    
+    ASSERT_LT( n, 1000 );
+    
+    n = 0;
+    
+    p.Run( 100, [ & ]( size_t i ) { ( void )i; n++; } );
+    
+    ASSERT_EQ( n, 100 );
+}
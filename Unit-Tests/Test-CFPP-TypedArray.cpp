@@ -0,0 +1,280 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+/*!
+ * @file        Test-CFPP-TypedArray.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Unit tests for CF::TypedArray
+ */
+
+#include <CF++.hpp>
+
+#define XSTEST_GTEST_COMPAT
+#include <XSTest/XSTest.hpp>
+
+TEST( CFPP_TypedArray, CTOR )
+{
+    CF::TypedArray< CF::String > a;
+    
+    ASSERT_TRUE( a.IsValid() );
+    ASSERT_EQ( a.GetCount(), 0 );
+}
+
+TEST( CFPP_TypedArray, CTOR_Array )
+{
+    CF::Array                    a1( { CF::String( "hello" ), CF::String( "world" ) } );
+    CF::Array                    a2( { CF::String( "hello" ), CF::Number( 42 ) } );
+    CF::TypedArray< CF::String > t1( a1 );
+    CF::TypedArray< CF::String > t2( a2 );
+    CF::TypedArray< CF::Number > t3( a1 );
+    
+    ASSERT_TRUE(  t1.IsValid() );
+    ASSERT_FALSE( t2.IsValid() );
+    ASSERT_FALSE( t3.IsValid() );
+    ASSERT_EQ( t1.GetCount(), 2 );
+    ASSERT_EQ( t1.GetCFObject(), a1.GetCFObject() );
+}
+
+TEST( CFPP_TypedArray, CTOR_CFType )
+{
+    CF::Array                    a( { CF::Number( 1 ), CF::Number( 2 ) } );
+    CF::TypedArray< CF::Number > t1( static_cast< CFTypeRef >( a.GetCFObject() ) );
+    CF::TypedArray< CF::Number > t2( static_cast< CFTypeRef >( CF::String( "hello" ).GetCFObject() ) );
+    CF::TypedArray< CF::String > t3( static_cast< CFTypeRef >( a.GetCFObject() ) );
+    
+    ASSERT_TRUE(  t1.IsValid() );
+    ASSERT_FALSE( t2.IsValid() );
+    ASSERT_FALSE( t3.IsValid() );
+    ASSERT_EQ( t1.GetCount(), 2 );
+}
+
+TEST( CFPP_TypedArray, CTOR_NullPointer )
+{
+    CF::TypedArray< CF::String > a( nullptr );
+    
+    ASSERT_FALSE( a.IsValid() );
+}
+
+TEST( CFPP_TypedArray, CTOR_STDInitializerList )
+{
+    CF::TypedArray< CF::String > a( { "hello", "world" } );
+    
+    ASSERT_EQ( a.GetCount(), 2 );
+    ASSERT_EQ( CF::String( a[ 0 ] ), "hello" );
+    ASSERT_EQ( CF::String( a[ 1 ] ), "world" );
+}
+
+TEST( CFPP_TypedArray, CTOR_STDVector )
+{
+    std::vector< CF::Number >    v = { CF::Number( 1 ), CF::Number( 2 ), CF::Number( 3 ) };
+    CF::TypedArray< CF::Number > a( v );
+    
+    ASSERT_EQ( a.GetCount(), 3 );
+    ASSERT_EQ( CF::Number( a[ 2 ] ), 3 );
+}
+
+TEST( CFPP_TypedArray, CCTOR )
+{
+    CF::TypedArray< CF::String > a1( { CF::String( "hello" ) } );
+    CF::TypedArray< CF::String > a2( a1 );
+    
+    ASSERT_EQ( a1.GetCFObject(), a2.GetCFObject() );
+    
+    a2 << "world";
+    
+    ASSERT_EQ( a1.GetCount(), 1 );
+    ASSERT_EQ( a2.GetCount(), 2 );
+}
+
+TEST( CFPP_TypedArray, MCTOR )
+{
+    CF::TypedArray< CF::String > a1( { CF::String( "hello" ) } );
+    CF::TypedArray< CF::String > a2( std::move( a1 ) );
+    
+    ASSERT_FALSE( a1.IsValid() );
+    ASSERT_EQ( a2.GetCount(), 1 );
+}
+
+TEST( CFPP_TypedArray, OperatorAssign )
+{
+    CF::TypedArray< CF::String > a1( { CF::String( "hello" ) } );
+    CF::TypedArray< CF::String > a2;
+    
+    a2 = a1;
+    
+    ASSERT_EQ( a2.GetCount(), 1 );
+    
+    a2 = CF::Array( { CF::Number( 42 ) } );
+    
+    ASSERT_FALSE( a2.IsValid() );
+}
+
+TEST( CFPP_TypedArray, OperatorPlusEqual )
+{
+    CF::TypedArray< CF::String > a1( { CF::String( "hello" ) } );
+    CF::TypedArray< CF::String > a2( { CF::String( "world" ) } );
+    
+    a1 += a2;
+    
+    ASSERT_EQ( a1.GetCount(), 2 );
+    ASSERT_EQ( CF::String( a1[ 1 ] ), "world" );
+}
+
+TEST( CFPP_TypedArray, OperatorLeftShift )
+{
+    CF::TypedArray< CF::String > a;
+    
+    a << "hello" << CF::String( "world" );
+    
+    ASSERT_EQ( a.GetCount(), 2 );
+}
+
+TEST( CFPP_TypedArray, OperatorSubscript )
+{
+    CF::TypedArray< CF::Number > a( { CF::Number( 1 ), CF::Number( 2 ) } );
+    CFNumberRef                  n;
+    
+    n = a[ 1 ];
+    
+    ASSERT_TRUE( n != nullptr );
+    ASSERT_EQ( CF::Number( n ), 2 );
+    ASSERT_TRUE( a[ 2 ] == nullptr );
+}
+
+TEST( CFPP_TypedArray, GetElementTypeID )
+{
+    ASSERT_EQ( CF::TypedArray< CF::String >::GetElementTypeID(), CFStringGetTypeID() );
+    ASSERT_EQ( CF::TypedArray< CF::Number >::GetElementTypeID(), CFNumberGetTypeID() );
+    ASSERT_EQ( CF::TypedArray< CF::Dictionary >::GetElementTypeID(), CFDictionaryGetTypeID() );
+}
+
+TEST( CFPP_TypedArray, GetValueAtIndex )
+{
+    CF::TypedArray< CF::String > a( { CF::String( "hello" ) } );
+    
+    ASSERT_EQ( CF::String( a.GetValueAtIndex( 0 ) ), "hello" );
+    ASSERT_TRUE( a.GetValueAtIndex( 1 ) == nullptr );
+}
+
+TEST( CFPP_TypedArray, GetValueAtIndex_Foreign )
+{
+    CF::TypedArray< CF::String > a1( { CF::String( "hello" ) } );
+    CF::Array                  & a2( a1 );
+    
+    a2 << CF::Number( 42 );
+    
+    ASSERT_EQ( a1.GetCount(), 2 );
+    ASSERT_TRUE( a1[ 1 ] == nullptr );
+    ASSERT_TRUE( a1.GetValueAtIndex( 1 ) == nullptr );
+    ASSERT_TRUE( *( ++( a1.begin() ) ) == nullptr );
+}
+
+TEST( CFPP_TypedArray, SetValueAtIndex )
+{
+    CF::TypedArray< CF::String > a( { CF::String( "hello" ) } );
+    
+    a.SetValueAtIndex( "world", 0 );
+    a.SetValueAtIndex( static_cast< CFTypeRef >( CF::Number( 42 ).GetCFObject() ), 0 );
+    
+    ASSERT_EQ( a.GetCount(), 1 );
+    ASSERT_EQ( CF::String( a[ 0 ] ), "world" );
+}
+
+TEST( CFPP_TypedArray, InsertValueAtIndex )
+{
+    CF::TypedArray< CF::String > a( { CF::String( "world" ) } );
+    
+    a.InsertValueAtIndex( "hello", 0 );
+    a.InsertValueAtIndex( static_cast< CFTypeRef >( CF::Number( 42 ).GetCFObject() ), 0 );
+    
+    ASSERT_EQ( a.GetCount(), 2 );
+    ASSERT_EQ( CF::String( a[ 0 ] ), "hello" );
+}
+
+TEST( CFPP_TypedArray, AppendValue )
+{
+    CF::TypedArray< CF::String > a;
+    
+    a.AppendValue( "hello" );
+    a.AppendValue( static_cast< CFTypeRef >( CF::Number( 42 ).GetCFObject() ) );
+    
+    ASSERT_EQ( a.GetCount(), 1 );
+}
+
+TEST( CFPP_TypedArray, AppendValues )
+{
+    CF::Array                    a1( { CF::String( "hello" ), CF::Number( 42 ), CF::String( "world" ) } );
+    CF::TypedArray< CF::String > a2;
+    
+    a2.AppendValues( a1.begin(), a1.end() );
+    
+    ASSERT_EQ( a2.GetCount(), 2 );
+    ASSERT_EQ( CF::String( a2[ 1 ] ), "world" );
+}
+
+TEST( CFPP_TypedArray, Iterator )
+{
+    CF::TypedArray< CF::String > a( { "hello", "world" } );
+    std::string                  s;
+    
+    for( CFStringRef str: a )
+    {
+        s += CF::String( str ).GetValue();
+    }
+    
+    ASSERT_EQ( s, "helloworld" );
+    ASSERT_EQ( std::distance( a.begin(), a.end() ), 2 );
+    ASSERT_TRUE( CF::TypedArray< CF::String >( nullptr ).begin() == CF::TypedArray< CF::String >( nullptr ).end() );
+}
+
+TEST( CFPP_TypedArray, Iterator_RandomAccess )
+{
+    CF::TypedArray< CF::String >           a( { "hello", "world", "!" } );
+    CF::TypedArray< CF::String >::Iterator i( a.begin() );
+    
+    ASSERT_EQ( a.end() - a.begin(), 3 );
+    ASSERT_TRUE( i < a.end() );
+    ASSERT_TRUE( i <= a.begin() );
+    ASSERT_TRUE( a.end() > i );
+    ASSERT_TRUE( a.end() >= a.end() );
+    ASSERT_TRUE( 2 + i == a.end() - 1 );
+    ASSERT_EQ( CF::String( i[ 1 ] ), "world" );
+    ASSERT_EQ( CF::String( *( a.end() - 1 ) ), "!" );
+    
+    std::advance( i, 2 );
+    
+    ASSERT_EQ( CF::String( *( i ) ), "!" );
+}
+
+TEST( CFPP_TypedArray, Swap )
+{
+    CF::TypedArray< CF::String > a1( { CF::String( "hello" ) } );
+    CF::TypedArray< CF::String > a2;
+    
+    swap( a1, a2 );
+    
+    ASSERT_EQ( a1.GetCount(), 0 );
+    ASSERT_EQ( a2.GetCount(), 1 );
+}
@@ -460,6 +460,33 @@ TEST( CFPP_WriteStream, Write_Data )
     ASSERT_EQ( s3.Write( d ), -1 );
 }
 
+TEST( CFPP_WriteStream, Write_DataView )
+{
+    CF::WriteStream s1;
+    CF::WriteStream s2( "/tmp/com.xs-labs.cfpp" );
+    CF::Data::Byte  buf[ 4 ];
+    
+    buf[ 0 ] = 0xDE;
+    buf[ 1 ] = 0xAD;
+    buf[ 2 ] = 0xBE;
+    buf[ 3 ] = 0xEF;
+    
+    ASSERT_EQ( s1.Write( CF::DataView( buf, sizeof( buf ) ) ), -1 );
+    ASSERT_EQ( s2.Write( CF::DataView( buf, sizeof( buf ) ) ), -1 );
+    
+    s1.Open();
+    s2.Open();
+    
+    ASSERT_EQ( s1.Write( CF::DataView( buf, sizeof( buf ) ) ), -1 );
+    ASSERT_EQ( s2.Write( CF::DataView( buf, sizeof( buf ) ).Slice( 2 ) ), 2 );
+    ASSERT_EQ( s2.Write( CF::DataView() ), -1 );
+    
+    s1.Close();
+    s2.Close();
+    
+    ASSERT_EQ( s2.Write( CF::DataView( buf, sizeof( buf ) ) ), -1 );
+}
+
 TEST( CFPP_WriteStream, WriteAll_BytePtr_CFIndex )
 {
     CF::WriteStream s1;
@@ -541,6 +568,33 @@ TEST( CFPP_WriteStream, WriteAll_Data )
     ASSERT_FALSE( s3.WriteAll( d ) );
 }
 
+TEST( CFPP_WriteStream, WriteAll_DataView )
+{
+    CF::WriteStream s1;
+    CF::WriteStream s2( "/tmp/com.xs-labs.cfpp" );
+    CF::Data::Byte  buf[ 4 ];
+    
+    buf[ 0 ] = 0xDE;
+    buf[ 1 ] = 0xAD;
+    buf[ 2 ] = 0xBE;
+    buf[ 3 ] = 0xEF;
+    
+    ASSERT_FALSE( s1.WriteAll( CF::DataView( buf, sizeof( buf ) ) ) );
+    ASSERT_FALSE( s2.WriteAll( CF::DataView( buf, sizeof( buf ) ) ) );
+    
+    s1.Open();
+    s2.Open();
+    
+    ASSERT_FALSE( s1.WriteAll( CF::DataView( buf, sizeof( buf ) ) ) );
+    ASSERT_TRUE(  s2.WriteAll( CF::DataView( buf, sizeof( buf ) ).Slice( 1 ) ) );
+    ASSERT_FALSE( s2.WriteAll( CF::DataView() ) );
+    
+    s1.Close();
+    s2.Close();
+    
+    ASSERT_FALSE( s2.WriteAll( CF::DataView( buf, sizeof( buf ) ) ) );
+}
+
 TEST( CFPP_WriteStream, GetProperty )
 {
     CF::WriteStream s1;
@@ -0,0 +1,201 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+/*!
+ * @file        Test-CFPP-XXHash64.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Unit tests for CF::XXHash64
+ */
+
+#include <CF++.hpp>
+
+#define XSTEST_GTEST_COMPAT
+#include <XSTest/XSTest.hpp>
+
+TEST( CFPP_XXHash64, CTOR )
+{
+    CF::XXHash64 h;
+    
+    ASSERT_EQ( h.GetValue(), 0xEF46DB3751D8E999ULL );
+}
+
+TEST( CFPP_XXHash64, CTOR_Seed )
+{
+    CF::XXHash64 h1( 1 );
+    CF::XXHash64 h2( 1 );
+    
+    h2 << CF::Data( std::string( "Nobody inspects the spammish repetition" ) );
+    
+    ASSERT_EQ( h1.GetValue(), 0xD5AFBA1336A3BE4BULL );
+    ASSERT_EQ( h2.GetValue(), 0x43F425448D954DB6ULL );
+}
+
+TEST( CFPP_XXHash64, CCTOR )
+{
+    CF::XXHash64 h1;
+    
+    h1.Update( CF::Data( std::string( "abc" ) ) );
+    
+    {
+        CF::XXHash64 h2( h1 );
+        
+        ASSERT_EQ( h2.GetValue(), 0x44BC2CF5AD770999ULL );
+    }
+}
+
+TEST( CFPP_XXHash64, MCTOR )
+{
+    CF::XXHash64 h1;
+    
+    h1.Update( CF::Data( std::string( "abc" ) ) );
+    
+    {
+        CF::XXHash64 h2( std::move( h1 ) );
+        
+        ASSERT_EQ( h2.GetValue(), 0x44BC2CF5AD770999ULL );
+        ASSERT_EQ( h1.GetValue(), 0xEF46DB3751D8E999ULL );
+    }
+}
+
+TEST( CFPP_XXHash64, OperatorAssign )
+{
+    CF::XXHash64 h1;
+    CF::XXHash64 h2;
+    
+    h1.Update( CF::Data( std::string( "abc" ) ) );
+    
+    h2 = h1;
+    
+    ASSERT_EQ( h2.GetValue(), 0x44BC2CF5AD770999ULL );
+}
+
+TEST( CFPP_XXHash64, OperatorShiftLeft )
+{
+    CF::XXHash64 h;
+    
+    h << CF::Data( std::string( "a" ) ) << CF::Data( std::string( "bc" ) );
+    
+    ASSERT_EQ( h.GetValue(), 0x44BC2CF5AD770999ULL );
+}
+
+TEST( CFPP_XXHash64, Update )
+{
+    CF::XXHash64 h;
+    
+    h.Update( reinterpret_cast< const CF::Data::Byte * >( "123456789" ), 9 );
+    
+    ASSERT_EQ( h.GetValue(), 0x8CB841DB40E6AE83ULL );
+    
+    h.Update( nullptr, 10 );
+    
+    ASSERT_EQ( h.GetValue(), 0x8CB841DB40E6AE83ULL );
+}
+
+TEST( CFPP_XXHash64, Update_Long )
+{
+    CF::XXHash64 h;
+    
+    /* Past 32 bytes, input goes through the four lanes before the tail */
+    h << CF::Data( std::string( "Nobody inspects the spammish repetition" ) );
+    
+    ASSERT_EQ( h.GetValue(), 0xFBCEA83C8A378BF1ULL );
+    
+    h.Reset();
+    h << CF::Data( std::string( "abcdbcdecdefdefgefghfghighijhijkijkl" ) ) << CF::Data( std::string( "jklmklmnlmnomnopnopq" ) );
+    
+    ASSERT_EQ( h.GetValue(), 0xF06103773E8585DFULL );
+}
+
+TEST( CFPP_XXHash64, Update_Incremental )
+{
+    CF::Data     d( std::string( 1000000, 'a' ) );
+    CF::XXHash64 h;
+    CFIndex      i;
+    
+    for( i = 0; i < d.GetLength(); i += 37 )
+    {
+        h.Update( CF::DataView( d, CFRangeMake( i, std::min< CFIndex >( 37, d.GetLength() - i ) ) ) );
+    }
+    
+    ASSERT_EQ( h.GetValue(), 0xDC483AAA9B4FDC40ULL );
+}
+
+TEST( CFPP_XXHash64, Update_Stream )
+{
+    CF::ReadStream s;
+    CF::Data       d;
+    CF::XXHash64   h;
+    
+    s.Open( "/etc/hosts" );
+    
+    d = s.Read();
+    
+    s.Close();
+    s.Open( "/etc/hosts" );
+    
+    for( CF::ReadStream::Iterator it = s.begin( 16 ); it != s.end(); ++it )
+    {
+        h << *( it );
+    }
+    
+    s.Close();
+    
+    ASSERT_GT( d.GetLength(), 0 );
+    ASSERT_EQ( h.GetValue(), d.GetXXHash64() );
+}
+
+TEST( CFPP_XXHash64, GetValue )
+{
+    CF::XXHash64 h;
+    
+    h << CF::Data( std::string( "abc" ) );
+    
+    ASSERT_EQ( h.GetValue(), 0x44BC2CF5AD770999ULL );
+    ASSERT_EQ( h.GetValue(), 0x44BC2CF5AD770999ULL );
+}
+
+TEST( CFPP_XXHash64, Reset )
+{
+    CF::XXHash64 h;
+    
+    h << CF::Data( std::string( "abc" ) );
+    
+    h.Reset();
+    
+    ASSERT_EQ( h.GetValue(), 0xEF46DB3751D8E999ULL );
+}
+
+TEST( CFPP_XXHash64, Swap )
+{
+    CF::XXHash64 h1;
+    CF::XXHash64 h2;
+    
+    h1 << CF::Data( std::string( "abc" ) );
+    
+    swap( h1, h2 );
+    
+    ASSERT_EQ( h1.GetValue(), 0xEF46DB3751D8E999ULL );
+    ASSERT_EQ( h2.GetValue(), 0x44BC2CF5AD770999ULL );
+}